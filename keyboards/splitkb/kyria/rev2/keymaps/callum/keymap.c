@@ -28,6 +28,7 @@
 #include "quantum/keycodes.h"
 #include "keymap_swedish.h"
 #include "print.h"
+#include "kajih.h"
 
 enum layers {
     _QWERTY,
@@ -53,7 +54,7 @@ enum tapdance {
 
 // Keycodes
 enum custom_keycodes {
-    CLBRC = SAFE_RANGE,
+    CLBRC = USER_SAFE_RANGE,
     CRBRC,
     CBPIP,
     CCLN
@@ -407,24 +408,8 @@ tap_dance_action_t tap_dance_actions[] = {
     [TD_Q]      = ACTION_TAP_DANCE_FN(tapQuote)
 };
 
-// Custom Shift/Normal Tapkey redefines
-bool shift_and_tap16(keyrecord_t *record, uint16_t scode, uint16_t code) {
-    uint8_t mods = get_mods();
-    if (record->event.pressed) {
-        del_mods(MOD_MASK_SHIFT);
-        if (mods & MOD_MASK_SHIFT) {
-            tap_code16(scode);
-        } else {
-            tap_code16(code);
-        }
-        set_mods(mods);
-        return false;
-    }
-    return true;
-}
-
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    uprintf("Keycode %u in process_record_user\n", keycode);
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    uprintf("Keycode %u in process_record_keymap\n", keycode);
     bool process = true;
     switch (keycode) {
         case CLBRC:
@@ -451,7 +436,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             ;
     }
 
-    uprintf("Exiting process_record_user %u\n", process);
+    uprintf("Exiting process_record_keymap %u\n", process);
     return process;
 }
 
@@ -464,16 +449,6 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return update_tri_layer_state(state, _NAV, _NUM, _TRI);
 }
 
-void render_logo(void) {
-    static const char PROGMEM qmk_logo[] = {
-        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
-        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00
-    };
-
-    oled_write_P(qmk_logo, false);
-}
-
 void render_state(void) {
     oled_write_P(PSTR("\n"), false);
 
@@ -536,16 +511,14 @@ void render_state(void) {
     oled_write_P(is_caps_word_on() ? PSTR("W") : PSTR(" "), false);
 }
 
-static char offhand[RPC_M2S_BUFFER_SIZE];
-
-bool oled_task_user(void) {
+bool oled_task_keymap(void) {
     if (is_keyboard_master()) {
         render_logo();
         render_state();
     } else {
         // Off-Hand
         render_logo();
-        oled_write(offhand, false);
+        offhand_render();
     }
     return false;
 }
@@ -569,23 +542,3 @@ bool encoder_update_user(uint8_t index, bool clockwise) {
     }
     return true;
 }
-
-/*
-// USB HID HANDLING
-void raw_hid_receive(uint8_t *data, uint8_t length) {
-    dprintf("raw_hid_receive - received %u bytes \n", length);
-    if (is_keyboard_master()) {
-        dprint("RPC_ID_USER_HID_SYNC \n");
-        transaction_rpc_send(RPC_ID_USER_HID_SYNC, length, data);
-    }
-}
-
-void hid_sync(uint8_t in_buflen, const void* in_data, uint8_t out_buflen, void* out_data) {
-    memcpy(offhand, in_data, in_buflen);
-}
-
-void keyboard_post_init_user() {
-    memset(offhand, 0, RPC_M2S_BUFFER_SIZE);
-    transaction_register_rpc(RPC_ID_USER_HID_SYNC, hid_sync);
-}
-*/
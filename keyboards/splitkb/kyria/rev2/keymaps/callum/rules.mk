@@ -11,6 +11,7 @@ AUDIO_ENABLE = no          # Audio output
 TAP_DANCE_ENABLE = yes
 
 OLED_ENABLE = yes          # Enables the use of OLED displays
+HID_PROTOCOL_ENABLE = yes  # Raw HID commands, off-hand OLED text
 ENCODER_ENABLE = yes       # Enables the use of one or more encoders
 RGB_MATRIX_ENABLE = no     # Enable keyboard RGB matrix (do not use together with RGBLIGHT_ENABLE)
 RGBLIGHT_ENABLE = no       # Enable keyboard RGB underglow
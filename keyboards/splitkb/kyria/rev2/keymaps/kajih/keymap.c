@@ -17,12 +17,12 @@
 #include QMK_KEYBOARD_H
 
 #include "default_keyboard.h"
-#include "transactions.h"
 #include "config.h"
 
 #include "quantum.h"
 #include "quantum/keycodes.h"
 #include "keymap_swedish.h"
+#include "kajih.h"
 
 enum layers {
     _QWERTY = 0,
@@ -235,15 +235,6 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return update_tri_layer_state(state, _NAV, _SYM, _TRI);
 }
 
-void render_logo(void) {
-    static const char PROGMEM qmk_logo[] = {
-        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
-        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00
-    };
-    oled_write_P(qmk_logo, false);
-}
-
 void render_state(void) {
 
     oled_write_P(PSTR("\n"), false);
@@ -292,8 +283,6 @@ void render_state(void) {
     oled_write_P(is_caps_word_on() ? PSTR("W") : PSTR(" "), false);
 }
 
-static char offhand[RPC_M2S_BUFFER_SIZE];
-
 bool oled_task_kb(void) {
     if (!oled_task_user()) {
         return false;
@@ -304,7 +293,9 @@ bool oled_task_kb(void) {
     } else {
         // Off-Hand
         render_logo();
-        oled_write(offhand, false);
+#ifdef HID_PROTOCOL_ENABLE
+        offhand_render();
+#endif
     }
     return false;
 }
@@ -331,20 +322,3 @@ bool encoder_update_kb(uint8_t index, bool clockwise) {
     }
     return true;
 }
-
-void raw_hid_receive(uint8_t *data, uint8_t length) {
-    dprintf("raw_hid_receive - received %u bytes \n", length);
-    if (is_keyboard_master()) {
-        dprint("RPC_ID_USER_HID_SYNC \n");
-        transaction_rpc_send(RPC_ID_USER_HID_SYNC, length, data);
-    }
-}
-
-void hid_sync(uint8_t in_buflen, const void* in_data, uint8_t out_buflen, void* out_data) {
-    memcpy(offhand, in_data, in_buflen);
-}
-
-void keyboard_post_init_user() {
-    memset(offhand, 0, RPC_M2S_BUFFER_SIZE);
-    transaction_register_rpc(RPC_ID_USER_HID_SYNC, hid_sync);
-}
@@ -8,6 +8,7 @@ BACKLIGHT_ENABLE = no      # Enable keyboard backlight functionality
 AUDIO_ENABLE = no          # Audio output
 
 OLED_ENABLE = yes          # Enables the use of OLED displays
+HID_PROTOCOL_ENABLE = yes  # Off-hand OLED text over raw HID
 ENCODER_ENABLE = yes       # Enables the use of one or more encoders
 RGB_MATRIX_ENABLE = no     # Enable keyboard RGB matrix (do not use together with RGBLIGHT_ENABLE)
 RGBLIGHT_ENABLE = no       # Enable keyboard RGB underglow
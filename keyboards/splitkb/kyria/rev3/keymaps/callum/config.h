@@ -18,8 +18,6 @@
 
 #define SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_HID_SYNC, RPC_ID_USER_CAPS_WORD_SYNC, RPC_ID_USER_LAYER_SYNC
 
-#define ONESHOT_TAP_TOGGLE 2
-
 #define FLOW_TAP_TERM 150
 #define TAPPING_TERM 180
 #define QUICK_TAP_TERM 100
@@ -28,6 +28,7 @@
 #include "quantum/keycodes.h"
 #include "keymap_swedish.h"
 #include "print.h"
+#include "kajih.h"
 
 enum layers {
     _QWERTY,
@@ -53,7 +54,7 @@ enum tapdance {
 
 // Keycodes
 enum custom_keycodes {
-    CLBRC = SAFE_RANGE,
+    CLBRC = USER_SAFE_RANGE,
     CRBRC,
     CBPIP,
     CCLN
@@ -90,15 +91,15 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * |--------+------+------+------+------+------+---------------.  ,-----------+------+------+------+------+------+--------|
      * | LCTL   |   Z  |   X  |   C  |   V  |   B  | ({[  |CapsTogg|  |F-keys| )}]|   N  |   M  | ,  < | . >  | /?  | Rctl   |
      * `----------------------+------+------+------+------+--------|  |------+------+------+------+------+--------------------'
-     *                        |Adjust| LGUI | Fun  | ModL | Nav    |  | Sym  | ModR | Num | RALT | RGUI |
-     *                        |      |      | Enter| Del  | Tab    |  | Esc  | Bspc |Space|      |      |
+     *                        |Adjust| LGUI | Fun  | ModL | Nav    |  | OS   | ModR | OS  | RALT | RGUI |
+     *                        |      |      | Del  | Enter| Tab    |  | Num  | Space| Sym |      |      |
      *                        `------------------------------------'  `---------------------------------'
      */
     [_QWERTY] = LAYOUT(
         KC_ESC,               KC_Q, KC_W, KC_E, KC_R   , KC_T            ,                                                                 KC_Y              , KC_U             , KC_I   , KC_O  , KC_P   , KC_BSPC,
         MT(MOD_LSFT, KC_TAB), KC_A, KC_S, KC_D, KC_F   , KC_G            ,                                                                 KC_H              , KC_J             , KC_K   , KC_L  , KC_BSLS, SE_DQUO,
         KC_LCTL,              KC_Z, KC_X, KC_C, KC_V   , KC_B            , TD(TD_LBRC)      , CW_TOGG         ,      FKEYS  , TD(TD_RBRC), KC_N              , KC_M             , KC_COMM, KC_DOT, KC_SLSH, KC_RCTL,
-                                           ADJ, KC_LGUI, LT(_FUN, KC_DEL), LT(_QMOL, KC_ENT), LT(_NAV, KC_TAB), /**/ LT(_NUM, KC_ESC)    , LT(_QMOR, KC_SPC) , LT(_SYM, KC_BSPC), KC_RALT, KC_RGUI
+                                           ADJ, KC_LGUI, LT(_FUN, KC_DEL), LT(_QMOL, KC_ENT), LT(_NAV, KC_TAB), /**/ OSLAYER(_NUM)       , LT(_QMOR, KC_SPC) , OSLAYER(_SYM)    , KC_RALT, KC_RGUI
     ),
 
     /*
@@ -107,7 +108,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     * ,-------------------------------------------.                              ,-------------------------------------------.
     * |        |      |      |      |      |      |                              |      |      |      |      |      |        |
     * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
-    * |        | LGui | Alt  | Ctrl | Shft |      |                              |      |      |      |      |      |        |
+    * |        | LGui | Alt  | Ctrl | Shft |OSCncl|                              |      |      |      |      |      |        |
     * |--------+------+------+------+------+------+-------------.  ,-------------,-------------------------------------------.
     * |        |      |      |      |      |      |      |      |  |      |      |      |      |      |      |      |        |
     * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
@@ -117,7 +118,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     */
     [_QMOL] = LAYOUT(
         _______, _______, _______, _______, _______, _______,                                          _______, _______, _______, _______, _______, _______,
-        _______, OS_LGUI, OS_LALT, OS_LCTL, OS_LSFT, _______,                                          _______, _______, _______, _______, _______, _______,
+        _______, OSM_LGUI, OSM_LALT, OSM_LCTL, OSM_LSFT, OSCNCL ,                                          _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______, _______, _______, /**/ _______, _______, _______, _______, _______, _______, _______, _______,
                                    _______, _______, _______, _______, _______, /**/ KC_ESC , KC_SPC , KC_BSPC , _______, _______
     ),
@@ -139,7 +140,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
      [_QMOR] = LAYOUT(
         _______, _______, _______, _______, _______, _______,                                          _______, _______, _______, _______, _______, _______,
-        _______, KC_A,    KC_S,    KC_D,    KC_F,    _______,                                          _______, OS_RSFT, OS_RCTL, OS_RALT, OS_RGUI, _______,
+        _______, KC_A,    KC_S,    KC_D,    KC_F,    _______,                                          _______, OSM_RSFT, OSM_RCTL, OSM_RALT, OSM_RGUI, _______,
         _______, _______, _______, _______, _______, _______, _______, _______, /**/ _______, _______, _______, _______, _______, _______, _______, _______,
                                    _______, _______, KC_DEL , KC_ENT , KC_TAB , /**/ _______, _______, _______, _______, _______
     ),
@@ -154,15 +155,15 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * |--------+------+------+------+------+------+---------------.  ,-------------+------+------+------+------+------+--------|
      * | LShift |   Z  |   X  |   C  |   D  |   V  | ({[  | CapsL  |  |F-keys| )}]  |   K  |   H  | ,  < | . >  | /  ? | Rctl   |
      * `----------------------+------+------+------+------+--------|  |------+------+------+------+------+----------------------'
-     *                        |Adjust| LGUI | Fun  | ModL | Nav    |  | Sym  | ModR | Num | RALT | RGUI |
-     *                        |      |      | Del  | ENTR | Tab    |  | Esc  | Spae | BSPC|      |      |
+     *                        |Adjust| LGUI | Fun  | ModL | Nav    |  | OS   | ModR | OS  | RALT | RGUI |
+     *                        |      |      | Del  | ENTR | Tab    |  | Num  | Spae | Sym |      |      |
      *                        `------------------------------------'  `---------------------------------'
     */
     [_COLEMAK_DH] = LAYOUT(
         _______, KC_Q, KC_W, KC_F, KC_P   , KC_B,                                                                                                                  KC_J   , KC_L    , KC_U   ,   KC_Y, KC_SCLN, _______,
         _______, KC_A, KC_R, KC_S, KC_T   , KC_G,                                                                                                                  KC_M   , KC_N    , KC_E   ,   KC_I, KC_O   , _______,
         _______, KC_Z, KC_X, KC_C, KC_D   , KC_V,             TD(TD_LBRC),       KC_CAPS,                                                    FKEYS  , TD(TD_RBRC), KC_K   , KC_H    , KC_COMM, KC_DOT, KC_SLSH, _______,
-                              ADJ, KC_LGUI, LT(_FUN, KC_DEL), LT(_CMOL, KC_ENT), LT(_NAV, KC_TAB), /**/ LT(_NUM, KC_ESC), LT(_CMOR, KC_SPC), LT(_SYM, KC_BSPC)   , KC_RALT, KC_RGUI
+                              ADJ, KC_LGUI, LT(_FUN, KC_DEL), LT(_CMOL, KC_ENT), LT(_NAV, KC_TAB), /**/ OSLAYER(_NUM)    , LT(_CMOR, KC_SPC), OSLAYER(_SYM)       , KC_RALT, KC_RGUI
     ),
 
     /*
@@ -171,7 +172,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     * ,-------------------------------------------.                              ,-------------------------------------------.
     * |        |      |      |      |      |      |                              |      |      |      |      |      |        |
     * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
-    * |        | LGui | Alt  | Ctrl | Shft |      |                              |      |      |      |      |      |        |
+    * |        | LGui | Alt  | Ctrl | Shft |OSCncl|                              |      |      |      |      |      |        |
     * |--------+------+------+------+------+------+-------------.  ,-------------,-------------------------------------------.
     * |        |      |      |      |      |      |      |      |  |      |      |      |      |      |      |      |        |
     * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
@@ -181,7 +182,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
     */
     [_CMOL] = LAYOUT(
         _______, _______, _______, _______, _______, _______,                                          _______, _______, _______, _______, _______, _______,
-        _______, OS_LGUI, OS_LALT, OS_LCTL, OS_LSFT, _______,                                          _______, _______, _______, _______, _______, _______,
+        _______, OSM_LGUI, OSM_LALT, OSM_LCTL, OSM_LSFT, OSCNCL ,                                          _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, _______, _______, _______, /**/ _______, _______, _______, _______, _______, _______, _______, _______,
                                    _______, _______, _______, _______, _______, /**/ KC_ESC , KC_SPC , KC_BSPC, _______, _______
     ),
@@ -204,7 +205,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
      [_CMOR] = LAYOUT(
         _______, _______, _______, _______, _______, _______,                                          _______, _______, _______, _______, _______, _______,
-        _______, KC_A,    KC_R,    KC_S,    KC_T,    _______,                                          _______, OS_RSFT, OS_RCTL, OS_RALT, OS_RGUI, _______,
+        _______, KC_A,    KC_R,    KC_S,    KC_T,    _______,                                          _______, OSM_RSFT, OSM_RCTL, OSM_RALT, OSM_RGUI, _______,
         _______, _______, _______, _______, _______, _______, _______, _______, /**/ _______, _______, _______, _______, _______, _______, _______, _______,
                                    _______, _______, KC_DEL , KC_ENT , KC_TAB , /**/ _______, _______, _______, _______, _______
     ),
@@ -225,7 +226,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      */
      [_NUM] = LAYOUT(
         _______, CLBRC,  KC_7, KC_8,    KC_9,    CRBRC,                                       _______, _______, _______, _______, _______, _______,
-        _______, CCLN,   KC_4, KC_5,    KC_6,    SE_PLUS,                                     _______, OS_RSFT, OS_RCTL, OS_RALT, OS_RGUI, _______,
+        _______, CCLN,   KC_4, KC_5,    KC_6,    SE_PLUS,                                     _______, OSM_RSFT, OSM_RCTL, OSM_RALT, OSM_RGUI, _______,
         _______, SE_DOT, KC_1, KC_2,    KC_3,    CBPIP,   _______, _______, _______, _______, SE_QUOT, SE_DQUO, SE_LABK, SE_RABK, _______, _______,
                               _______, _______, SE_QUOT, KC_0,    LT(_NAV, SE_MINS), _______, _______, _______, _______, _______
     ),
@@ -267,7 +268,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      */
     [_FUN] = LAYOUT(
         _______, _______, _______, _______, _______, _______,                                     KC_NUM,  KC_F7, KC_F8, KC_F9, KC_F10,_______,
-        _______, OS_LGUI, OS_LALT, OS_LCTL, OS_LSFT, _______,                                     KC_CAPS, KC_F4, KC_F5, KC_F6, KC_F11,_______,
+        _______, OSM_LGUI, OSM_LALT, OSM_LCTL, OSM_LSFT, _______,                                     KC_CAPS, KC_F4, KC_F5, KC_F6, KC_F11,_______,
         _______, _______, _______, _______, _______, _______, _______, _______, _______, KC_BRK,  KC_SCRL, KC_F1, KC_F2, KC_F3, KC_F12,_______,
                                    _______, _______, _______, _______, _______, _______, _______, _______, _______, _______
     ),
@@ -288,7 +289,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      */
     [_NAV] = LAYOUT(
         _______, LGUI(KC_1), LGUI(KC_2), LGUI(KC_3), LGUI(KC_4), LGUI(KC_5),                     KC_HOME, KC_PGUP, KC_PGDN, KC_END, KC_VOLU, KC_DEL,
-        _______, OS_LGUI,    OS_LALT,    OS_LCTL,    OS_LSFT,    _______,                                    KC_LEFT, KC_DOWN, KC_UP, KC_RGHT, KC_VOLD, KC_INS,
+        _______, OSM_LGUI,    OSM_LALT,    OSM_LCTL,    OSM_LSFT,    _______,                                    KC_LEFT, KC_DOWN, KC_UP, KC_RGHT, KC_VOLD, KC_INS,
         _______, _______, _______, _______, _______, _______, _______, KC_SCRL, LCTL(LGUI(KC_LEFT)), LCTL(LGUI(KC_RGHT)),KC_PAUSE, KC_MPRV, KC_MPLY, KC_MNXT, KC_MUTE, KC_PSCR,
                                    _______, _______, _______, _______, _______, _______, _______, _______, _______, _______
     ),
@@ -329,7 +330,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      */
     [_TRI] = LAYOUT(
         QK_BOOT, _______, _______, _______, SE_CIRC, SE_TILD,                                     _______, _______, _______, SE_ODIA, _______, QK_BOOT,
-        _______, SE_ARNG, SE_ADIA, OS_LCTL, OS_LSFT, _______,                                     _______, OS_RSFT, OS_RCTL, OS_RALT, OS_RGUI, _______,
+        _______, SE_ARNG, SE_ADIA, OSM_LCTL, OSM_LSFT, _______,                                     _______, OSM_RSFT, OSM_RCTL, OSM_RALT, OSM_RGUI, _______,
         _______, _______, _______, _______, _______, _______, _______, DB_TOGG, _______, _______, _______, _______, _______, _______, _______, _______,
                                    _______, _______, _______, _______, _______, _______, _______, _______, _______, _______
     ),
@@ -407,24 +408,8 @@ tap_dance_action_t tap_dance_actions[] = {
     [TD_Q]      = ACTION_TAP_DANCE_FN(tapQuote)
 };
 
-// Custom Shift/Normal Tapkey redefines
-bool shift_and_tap16(keyrecord_t *record, uint16_t scode, uint16_t code) {
-    uint8_t mods = get_mods();
-    if (record->event.pressed) {
-        del_mods(MOD_MASK_SHIFT);
-        if (mods & MOD_MASK_SHIFT) {
-            tap_code16(scode);
-        } else {
-            tap_code16(code);
-        }
-        set_mods(mods);
-        return false;
-    }
-    return true;
-}
-
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    uprintf("Keycode %u in process_record_user\n", keycode);
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    uprintf("Keycode %u in process_record_keymap\n", keycode);
     bool process = true;
     switch (keycode) {
         case CLBRC:
@@ -451,7 +436,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             ;
     }
 
-    uprintf("Exiting process_record_user %u\n", process);
+    uprintf("Exiting process_record_keymap %u\n", process);
     return process;
 }
 
@@ -464,16 +449,6 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return update_tri_layer_state(state, _NAV, _NUM, _TRI);
 }
 
-void render_logo(void) {
-    static const char PROGMEM qmk_logo[] = {
-        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
-        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00
-    };
-
-    oled_write_P(qmk_logo, false);
-}
-
 void render_state(void) {
     oled_write_P(PSTR("\n"), false);
 
@@ -534,18 +509,21 @@ void render_state(void) {
     oled_write_P(mod_state & MOD_MASK_ALT ? PSTR("A") : PSTR(" "), false);
     oled_write_P(mod_state & MOD_MASK_GUI ? PSTR("G") : PSTR(" "), false);
     oled_write_P(is_caps_word_on() ? PSTR("W") : PSTR(" "), false);
-}
 
-static char offhand[RPC_M2S_BUFFER_SIZE];
+#ifdef MISFIRE_STATS_ENABLE
+    oled_write_P(PSTR("\n"), false);
+    misfire_render();
+#endif
+}
 
-bool oled_task_user(void) {
+bool oled_task_keymap(void) {
     if (is_keyboard_master()) {
         render_logo();
         render_state();
     } else {
         // Off-Hand
         render_logo();
-        oled_write(offhand, false);
+        offhand_render();
     }
     return false;
 }
@@ -569,23 +547,3 @@ bool encoder_update_user(uint8_t index, bool clockwise) {
     }
     return true;
 }
-
-/*
-// USB HID HANDLING
-void raw_hid_receive(uint8_t *data, uint8_t length) {
-    dprintf("raw_hid_receive - received %u bytes \n", length);
-    if (is_keyboard_master()) {
-        dprint("RPC_ID_USER_HID_SYNC \n");
-        transaction_rpc_send(RPC_ID_USER_HID_SYNC, length, data);
-    }
-}
-
-void hid_sync(uint8_t in_buflen, const void* in_data, uint8_t out_buflen, void* out_data) {
-    memcpy(offhand, in_data, in_buflen);
-}
-
-void keyboard_post_init_user() {
-    memset(offhand, 0, RPC_M2S_BUFFER_SIZE);
-    transaction_register_rpc(RPC_ID_USER_HID_SYNC, hid_sync);
-}
-*/
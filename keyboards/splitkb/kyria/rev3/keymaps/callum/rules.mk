@@ -8,6 +8,12 @@ SPLIT_MODS_ENABLE = yes
 SPLIT_ACTIVITY_ENABLE = yes
 
 OLED_ENABLE = yes
+HID_PROTOCOL_ENABLE = yes
+OLED_FLUSH_ENABLE = yes
+USAGE_STATS_ENABLE = yes
+HOLDTAP_STATS_ENABLE = yes
+MISFIRE_STATS_ENABLE = yes
+ONE_SHOT_ENABLE = yes
 QUANTUM_PAINTER_ENABLE = no # GPT
 
 ENCODER_ENABLE = yes
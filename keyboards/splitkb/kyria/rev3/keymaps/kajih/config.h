@@ -23,6 +23,8 @@
 
 #define TAPPING_TERM 175
 #define PERMISSIVE_HOLD
+#define SPECULATIVE_HOLD
+#define LEADER_FIRE_UNIQUE
 // #define RETRO_TAPPING
 // #define HOLD_ON_OTHER_KEY_PRESS
 
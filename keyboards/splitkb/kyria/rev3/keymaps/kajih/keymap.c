@@ -27,6 +27,7 @@
 #include "quantum.h"
 #include "quantum/keycodes.h"
 #include "keymap_swedish.h"
+#include "kajih.h"
 
 enum layers {
     _QWERTY = 0,
@@ -53,14 +54,35 @@ enum layers {
 #define CTL_MINS	MT(MOD_RCTL, KC_MINUS)
 #define ALT_ENT		MT(MOD_LALT, KC_ENT)
 
-/* COMBO CODE NOT USED
- const uint16_t PROGMEM test_combo1[] = {KC_A, KC_B, COMBO_END};
- const uint16_t PROGMEM test_combo2[] = {KC_C, KC_D, COMBO_END};
- combo_t key_combos[] = {
- COMBO(test_combo1, KC_ESC),
- COMBO(test_combo2, LCTL(KC_Z)), // keycodes with modifiers are possible too!
- };
- */
+// Chords by layout position (see users/kajih/geometry.h), so they hold on every base
+// layer, and only there. Brackets are vertical pairs under one finger, which
+// typing never presses together, unlike neighbours in a roll.
+// clang-format off
+const chord_t PROGMEM chords[] = {
+    CHORD(KC_ESC,  1,  2),  // Q W
+    CHORD(SE_LPRN, 7,  19), // U J / L N
+    CHORD(SE_RPRN, 8,  20), // I K / U E
+    CHORD(SE_LBRC, 19, 35), // J M / N H
+    CHORD(SE_RBRC, 20, 36), // K , / E ,
+};
+// clang-format on
+const uint8_t chord_count = ARRAY_SIZE(chords);
+
+#ifdef NAV_REPEAT_ENABLE
+// Repeat curves for _NAV: keycode, delay, ramp, start and fastest interval (ms)
+// clang-format off
+const nav_repeat_t PROGMEM nav_repeats[] = {
+    NAV_REPEAT(KC_LEFT, 180, 1500, 40,  8),
+    NAV_REPEAT(KC_RGHT, 180, 1500, 40,  8),
+    NAV_REPEAT(KC_UP,   180, 2000, 50, 10),
+    NAV_REPEAT(KC_DOWN, 180, 2000, 50, 10),
+    NAV_REPEAT(KC_PGUP, 250, 2000, 150, 40),
+    NAV_REPEAT(KC_PGDN, 250, 2000, 150, 40),
+    NAV_REPEAT(KC_DEL,  250, 1500, 60, 20),
+};
+// clang-format on
+const uint8_t nav_repeat_count = ARRAY_SIZE(nav_repeats);
+#endif
 
 //Tap Dance Declarations
 enum {
@@ -94,6 +116,18 @@ void tapQuote(tap_dance_state_t *state, void *user_data) {
     }
 }
 
+#ifdef GAME_MODE_ENABLE
+// Single tap of each tap dance, sent at once in game mode
+uint16_t game_tap_dance_keycode(uint8_t index) {
+    switch (index) {
+        case TD_LBRC: return SE_LPRN;
+        case TD_RBRC: return SE_RPRN;
+        case TD_Q: return SE_QUOT;
+        default: return KC_NO;
+    }
+}
+#endif
+
 tap_dance_action_t tap_dance_actions[] = {
     [TD_LBRC]  = ACTION_TAP_DANCE_FN(tapLeftBrace),
     [TD_RBRC]  = ACTION_TAP_DANCE_FN(tapRightBrace),
@@ -117,7 +151,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * |--------+------+------+------+------+------+---------------.  ,-----------+------+------+------+------+------+--------|
      * | LShift |   Z  |   X  |   C  |   V  |   B  |  {[  |CapsTogg|  |F-keys|  ]} |   N  |   M  | ,  < | . >  | /? | RShift |
      * `----------------------+------+------+------+------+--------|  |------+------+------+------+------+----------------------'
-     *                        |Adjust| LGUI | LAlt/| Space| Nav    |  | Sym  | Space| AltGr| RGUI | Menu |
+     *                        |Adjust| LGUI | LAlt/| Space| Nav    |  | Sym  | Space| AltGr|  Rep | ARep |
      *                        |      |      | Enter|      |        |  |      |      |      |      |      |
      *                        `------------------------------------'  `----------------------------------'
      */
@@ -125,7 +159,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         KC_TAB , KC_Q , KC_W , KC_E , KC_R , KC_T , KC_Y, KC_U , KC_I , KC_O , KC_P , KC_BSPC,
         CTL_ESC , KC_A , KC_S , KC_D , KC_F , KC_G , KC_H, KC_J , KC_K , KC_L , KC_SCLN, CTL_QUOT,
         KC_LSFT , KC_Z , KC_X , KC_C , KC_V , KC_B , TD(TD_LBRC) , CW_TOGG , FKEYS , TD(TD_RBRC) , KC_N, KC_M ,KC_COMM, KC_DOT ,KC_SLSH, KC_RSFT,
-        ADJUST , KC_LGUI, ALT_ENT, KC_SPC , NAV , SYM , KC_SPC ,KC_RALT, KC_RGUI, KC_APP
+        ADJUST , KC_LGUI, ALT_ENT, KC_SPC , NAV , SYM , KC_SPC ,KC_RALT, QK_REP , QK_AREP
     ),
     /*
      * Base Layer: Colemak DH
@@ -137,7 +171,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * |--------+------+------+------+------+------+-------------.  ,-------------+------+------+------+------+------+--------|
      * | LShift |   Z  |   X  |   C  |   D  |   V  | [ {  |CapsLk|  |F-keys|  ] } |   K  |   H  | ,  < | . >  | /  ? | RShift |
      * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
-     *                        |Adjust| LGUI | LAlt/| Space| Nav  |  | Sym  | Space| AltGr| RGUI | Menu |
+     *                        |Adjust| LGUI | LAlt/| Space| Nav  |  | Sym  | Space| AltGr|  Rep | ARep |
      *                        |      |      | Enter|      |      |  |      |      |      |      |      |
      *                        `----------------------------------'  `----------------------------------'
      */
@@ -145,7 +179,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         KC_TAB , KC_Q , KC_W , KC_F , KC_P , KC_B , KC_J, KC_L , KC_U , KC_Y ,KC_SCLN, KC_BSPC,
         CTL_ESC , KC_A , KC_R , KC_S , KC_T , KC_G , KC_M, KC_N , KC_E , KC_I , KC_O , CTL_QUOT,
         KC_LSFT , KC_Z , KC_X , KC_C , KC_D , KC_V , TD(TD_LBRC) , KC_CAPS , FKEYS , TD(TD_RBRC) , KC_K, KC_H ,KC_COMM, KC_DOT ,KC_SLSH, KC_RSFT,
-        ADJUST, KC_LGUI, ALT_ENT, KC_SPC , NAV , SYM , KC_SPC , KC_RALT , KC_RGUI, KC_APP
+        ADJUST, KC_LGUI, ALT_ENT, KC_SPC , NAV , SYM , KC_SPC , KC_RALT , QK_REP , QK_AREP
     ),
 
     /*
@@ -154,7 +188,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * ,-------------------------------------------.                              ,-------------------------------------------.
      * |   W1   |  W2  |  W3  |  W4  |  W5  |  W6  |                              | Home | PgUp | PgDn | End  | VolUp| Delete |
      * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
-     * |        |  GUI |  Alt | Ctrl | Shift|      |                              |   ←  |   ↓  |   ↑  |   →  | VolDn| Insert |
+     * |        |  GUI |  Alt | Ctrl | Shift| Lead |                              |   ←  |   ↓  |   ↑  |   →  | VolDn| Insert |
      * |--------+------+------+------+------+------+-------------.  ,-------------+------+------+------+------+------+--------|
      * |        |      |      |      |      |      |      |ScLck |  |  W←  |  W→  | Pause|M Prev|M Play|M Next|VolMut| PrtSc  |
      * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
@@ -164,7 +198,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      */
     [_NAV] = LAYOUT(
         LGUI(KC_1), LGUI(KC_2), LGUI(KC_3), LGUI(KC_4), LGUI(KC_5), LGUI(KC_6),                                    KC_HOME, KC_PGUP, KC_PGDN, KC_END, KC_VOLU, KC_DEL,
-        _______, KC_LGUI, KC_LALT, KC_LCTL, KC_LSFT, _______,                                    KC_LEFT, KC_DOWN, KC_UP, KC_RGHT, KC_VOLD, KC_INS,
+        _______, KC_LGUI, KC_LALT, KC_LCTL, KC_LSFT, LEAD,                                       KC_LEFT, KC_DOWN, KC_UP, KC_RGHT, KC_VOLD, KC_INS,
         _______, _______, _______, _______, _______, _______, _______, KC_SCRL, LCTL(LGUI(KC_LEFT)), LCTL(LGUI(KC_RGHT)),KC_PAUSE, KC_MPRV, KC_MPLY, KC_MNXT, KC_MUTE, KC_PSCR,
         _______, _______, _______, _______, _______, _______, _______, _______, _______, _______
     ),
@@ -215,20 +249,20 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      * Adjust Layer: Default layer settings, ADJUST / RGB
      *
      * ,-------------------------------------------.                              ,-------------------------------------------.
-     * |  TOG   | SAI  | HUI  | VAI  | MOD  |QWERTY|                              |      |  MW↓ |  MW↑ |      |      |        |
+     * |  TOG   | SAI  | HUI  | VAI  | MOD  |QWERTY|                              | Game |  MW↓ |  MW↑ |      |      |        |
      * |--------+------+------+------+------+------|                              |------+------+------+------+------+--------|
      * |        | SAD  | HUD  | VAD  | RMOD |Colmak|                              |  M←  |  M↓  |  M↑  |  M→  |      |        |
      * |--------+------+------+------+------+------+-------------.  ,-------------+------+------+------+------+------+--------|
-     * |        | SPU  | SPD  |      |      |      |      |      |  | MB3  | MB4  |      |      |      |      |      |        |
+     * |        | SPU  | SPD  | MRec | MPly | MFst |      |      |  | MB3  | MB4  |      |      |      |      |      |        |
      * `----------------------+------+------+------+------+------|  |------+------+------+------+------+----------------------'
      *                        |      |      |      |      |      |  |      |      |      |      |      |
      *                        |  X   |      |      |      |      |  | MB1  | MB2  | SPD0 | SPD1 | SPD2 |
      *                        `----------------------------------'  `----------------------------------'
      */
     [_ADJUST] = LAYOUT(
-        RM_TOGG, RM_SATU, RM_HUEU, RM_VALU, RM_NEXT, QWERTY,                                      _______, MS_WHLD, MS_WHLU, _______, _______, _______,
+        RM_TOGG, RM_SATU, RM_HUEU, RM_VALU, RM_NEXT, QWERTY,                                      GAME,    MS_WHLD, MS_WHLU, _______, _______, _______,
         _______, RM_SATD, RM_HUED, RM_VALD, RM_PREV, COLEMAK,                                     MS_LEFT, MS_DOWN, MS_UP, MS_RGHT, _______, _______,
-        _______, RM_SPDU, RM_SPDD, _______, _______, _______, _______, _______, MS_BTN3, MS_BTN4, _______, _______, _______, _______, _______, _______,
+        _______, RM_SPDU, RM_SPDD, MREC,    MPLAY,   MFAST,   _______, _______, MS_BTN3, MS_BTN4, _______, _______, _______, _______, _______, _______,
         _______, _______, _______, _______, _______, MS_BTN1, MS_BTN2, MS_ACL0, MS_ACL1, MS_ACL2
     ),
     /*
@@ -283,16 +317,6 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return update_tri_layer_state(state, _NAV, _SYM, _TRI);
 }
 
-void render_logo(void) {
-    static const char PROGMEM qmk_logo[] = {
-        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
-        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00
-    };
-
-    oled_write_P(qmk_logo, false);
-}
-
 void render_state(void) {
 
     oled_write_P(PSTR("\n"), false);
@@ -339,18 +363,24 @@ void render_state(void) {
     oled_write_P(mod_state & MOD_MASK_ALT ? PSTR("A") : PSTR(" "), false);
     oled_write_P(mod_state & MOD_MASK_GUI ? PSTR("G") : PSTR(" "), false);
     oled_write_P(is_caps_word_on() ? PSTR("W") : PSTR(" "), false);
-}
+#ifdef GAME_MODE_ENABLE
+    game_render();
+#endif
 
-static char offhand[RPC_M2S_BUFFER_SIZE];
+#ifdef MISFIRE_STATS_ENABLE
+    oled_write_P(PSTR("\n"), false);
+    misfire_render();
+#endif
+}
 
-bool oled_task_user(void) {
+bool oled_task_keymap(void) {
     if (is_keyboard_master()) {
         render_logo();
         render_state();
     } else {
         // Off-Hand
         render_logo();
-        oled_write(offhand, false);
+        offhand_render();
     }
     return false;
 }
@@ -374,22 +404,3 @@ bool encoder_update_user(uint8_t index, bool clockwise) {
     }
     return true;
 }
-
-
-// USB HID HANDLING
-void raw_hid_receive(uint8_t *data, uint8_t length) {
-    dprintf("raw_hid_receive - received %u bytes \n", length);
-    if (is_keyboard_master()) {
-        dprint("RPC_ID_USER_HID_SYNC \n");
-        transaction_rpc_send(RPC_ID_USER_HID_SYNC, length, data);
-    }
-}
-
-void hid_sync(uint8_t in_buflen, const void* in_data, uint8_t out_buflen, void* out_data) {
-    memcpy(offhand, in_data, in_buflen);
-}
-
-void keyboard_post_init_user() {
-    memset(offhand, 0, RPC_M2S_BUFFER_SIZE);
-    transaction_register_rpc(RPC_ID_USER_HID_SYNC, hid_sync);
-}
@@ -8,6 +8,19 @@ SPLIT_MODS_ENABLE = yes
 SPLIT_ACTIVITY_ENABLE = yes
 
 OLED_ENABLE = yes
+HID_PROTOCOL_ENABLE = yes
+OLED_FLUSH_ENABLE = yes
+USAGE_STATS_ENABLE = yes
+HOLDTAP_STATS_ENABLE = yes
+MISFIRE_STATS_ENABLE = yes
+CHORD_ENABLE = yes
+SEND_SE_ENABLE = yes
+MACRO_REC_ENABLE = yes
+LEADER_TRIE_ENABLE = yes
+TYPO_FIX_ENABLE = yes
+GAME_MODE_ENABLE = yes
+NAV_REPEAT_ENABLE = yes
+REPORT_BATCH_ENABLE = yes
 QUANTUM_PAINTER_ENABLE = no # GPT
 
 ENCODER_ENABLE = yes
@@ -15,6 +28,7 @@ KEY_OVERRIDE_ENABLE = no # Kyriel
 
 BOOTMAGIC_ENABLE = yes
 LAYER_LOCK_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
 CAPS_WORD_ENABLE = yes
 
 TAP_DANCE_ENABLE = yes
@@ -22,7 +22,13 @@
 
 
 #define TAPPING_TERM 175
+#define FLOW_TAP_TERM 150
 #define PERMISSIVE_HOLD
+#define SPECULATIVE_HOLD
+// Same hand press under a home row mod is a tap, opposite hand is a hold,
+// both decided on the press (hands from users/kajih/geometry.c)
+#define CHORDAL_HOLD
+#define HOLD_ON_OTHER_KEY_PRESS_PER_KEY
 // #define RETRO_TAPPING
 // #define HOLD_ON_OTHER_KEY_PRESS
 
@@ -27,6 +27,7 @@
 #include "quantum.h"
 #include "quantum/keycodes.h"
 #include "keymap_swedish.h"
+#include "kajih.h"
 
 enum layers {
     _QWERTY_HROW = 0,
@@ -73,14 +74,32 @@ enum layers {
 #define MRA(key)  MT(MOD_RALT, key)
 #define MRG(key)  MT(MOD_RGUI, key)
 
-/* COMBO CODE NOT USED
- const uint16_t PROGMEM test_combo1[] = {KC_A, KC_B, COMBO_END};
- const uint16_t PROGMEM test_combo2[] = {KC_C, KC_D, COMBO_END};
- combo_t key_combos[] = {
- COMBO(test_combo1, KC_ESC)
- COMBO(test_combo2, LCTL(KC_Z)), // keycodes with modifiers are possible too!
- };
- */
+// Chords by layout position (see users/kajih/geometry.h), so they hold on every base
+// layer, and only there. Brackets are vertical pairs on the inner index
+// columns: off the home row mods, and one finger never presses them together
+// while typing.
+// clang-format off
+const chord_t PROGMEM chords[] = {
+    CHORD(KC_ESC,  1,  2),  // Q W
+    CHORD(SE_LPRN, 6,  18), // Y H / J M
+    CHORD(SE_RPRN, 18, 34), // H N / M K
+    CHORD(SE_LBRC, 5,  17), // T G / B G
+    CHORD(SE_RBRC, 17, 29), // G B / G V
+};
+// clang-format on
+const uint8_t chord_count = ARRAY_SIZE(chords);
+
+// Flow tap windows in ms for the home row mods, 0 is FLOW_TAP_TERM. Shift is
+// kept short so a capital straight after a letter still holds, the pinky and
+// ring mods get longer since rolls over them misfire most.
+// clang-format off
+const uint8_t PROGMEM flow_tap_terms[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+    0,   0,   0,   0,   0,   0,                      0,   0,   0,   0,   0,   0,
+    0, 175, 175,   0, 100,   0,                      0, 100,   0, 175, 175, 100,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+                   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+);
+// clang-format on
 
 //Tap Dance Declarations
 enum custom_tapdance {
@@ -122,30 +141,13 @@ tap_dance_action_t tap_dance_actions[] = {
 
 //Tap Dance END
 enum custom_keycodes {
-    CLBRC = SAFE_RANGE,
+    CLBRC = USER_SAFE_RANGE,
     CRBRC,
     CBPIP,
     CCLN
 };
 
-// Custom Shift/Normal Tapkey redefines
-bool shift_and_tap16(keyrecord_t *record, uint16_t scode, uint16_t code) {
-
-    uint8_t mods = get_mods();
-    if (record->event.pressed) {
-        del_mods(MOD_MASK_SHIFT);
-        if (mods & MOD_MASK_SHIFT) {
-            tap_code16(scode);
-        } else {
-            tap_code16(code);
-        }
-        set_mods(mods);
-        return false;
-    }
-    return true;
-}
-
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
 
     bool process = true;
     switch (keycode) {
@@ -411,16 +413,6 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return update_tri_layer_state(state, _NAV, _NUM, _TRI);
 }
 
-void render_logo(void) {
-    static const char PROGMEM qmk_logo[] = {
-        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
-        0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-        0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00
-    };
-
-    oled_write_P(qmk_logo, false);
-}
-
 void render_state(void) {
 
     oled_write_P(PSTR("\n"), false);
@@ -482,18 +474,21 @@ void render_state(void) {
     oled_write_P(mod_state & MOD_MASK_ALT ? PSTR("A") : PSTR(" "), false);
     oled_write_P(mod_state & MOD_MASK_GUI ? PSTR("G") : PSTR(" "), false);
     oled_write_P(is_caps_word_on() ? PSTR("W") : PSTR(" "), false);
-}
 
-static char offhand[RPC_M2S_BUFFER_SIZE];
+#ifdef MISFIRE_STATS_ENABLE
+    oled_write_P(PSTR("\n"), false);
+    misfire_render();
+#endif
+}
 
-bool oled_task_user(void) {
+bool oled_task_keymap(void) {
     if (is_keyboard_master()) {
         render_logo();
         render_state();
     } else {
         // Off-Hand
         render_logo();
-        oled_write(offhand, false);
+        offhand_render();
     }
     return false;
 }
@@ -517,22 +512,3 @@ bool encoder_update_user(uint8_t index, bool clockwise) {
     }
     return true;
 }
-
-
-// USB HID HANDLING
-void raw_hid_receive(uint8_t *data, uint8_t length) {
-    dprintf("raw_hid_receive - received %u bytes \n", length);
-    if (is_keyboard_master()) {
-        dprint("RPC_ID_USER_HID_SYNC \n");
-        transaction_rpc_send(RPC_ID_USER_HID_SYNC, length, data);
-    }
-}
-
-void hid_sync(uint8_t in_buflen, const void* in_data, uint8_t out_buflen, void* out_data) {
-    memcpy(offhand, in_data, in_buflen);
-}
-
-void keyboard_post_init_user() {
-    memset(offhand, 0, RPC_M2S_BUFFER_SIZE);
-    transaction_register_rpc(RPC_ID_USER_HID_SYNC, hid_sync);
-}
@@ -0,0 +1,56 @@
+#include "alt_repeat.h"
+#include "kajih.h"
+
+#include "keymap_swedish.h"
+
+// clang-format off
+static const uint16_t PROGMEM alt_repeat[ALT_REPEAT_KEYS][ALT_REPEAT_CLASSES] = {
+    // Closing brackets
+    ALT_REPEAT(SE_LPRN, SE_RPRN),
+    ALT_REPEAT(SE_LBRC, SE_RBRC),
+    ALT_REPEAT(SE_LCBR, SE_RCBR),
+    ALT_REPEAT(SE_LABK, SE_RABK),
+
+    // Two character operators and escapes
+    ALT_REPEAT(SE_MINS, SE_RABK), // ->
+    ALT_REPEAT(SE_EQL,  SE_RABK), // =>
+    ALT_REPEAT(SE_EXLM, SE_EQL),  // !=
+    ALT_REPEAT(SE_PLUS, SE_EQL),  // +=
+    ALT_REPEAT(SE_COLN, SE_EQL),  // :=
+    ALT_REPEAT(SE_SLSH, SE_ASTR), // /*
+    ALT_REPEAT(SE_ASTR, SE_SLSH), // */
+    ALT_REPEAT(SE_DLR,  SE_LCBR), // ${
+    ALT_REPEAT(SE_BSLS, KC_N),    // \n
+    ALT_REPEAT(SE_COMM, KC_SPC),
+
+    // Same finger bigrams on QWERTY, the second key without moving the finger
+    ALT_REPEAT(KC_E, KC_D),
+    ALT_REPEAT(KC_D, KC_E),
+    ALT_REPEAT(KC_C, KC_E),
+    ALT_REPEAT(KC_U, KC_N),
+    ALT_REPEAT(KC_N, KC_U),
+    ALT_REPEAT(KC_O, KC_L),
+    ALT_REPEAT(KC_L, KC_O),
+    ALT_REPEAT(KC_R, KC_T),
+    ALT_REPEAT(KC_T, KC_R),
+    ALT_REPEAT(KC_B, KC_R),
+    ALT_REPEAT(KC_G, KC_R),
+    ALT_REPEAT(KC_F, KC_T),
+    ALT_REPEAT(KC_M, KC_Y),
+    ALT_REPEAT(KC_J, KC_U),
+};
+// clang-format on
+
+uint16_t get_alt_repeat_key_keycode_user(uint16_t keycode, uint8_t mods) {
+    if (IS_QK_MODS(keycode)) {
+        mods |= report_mods(keycode);
+        keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+    }
+    if (keycode >= ALT_REPEAT_KEYS || (mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT)))) {
+        return KC_TRNS;
+    }
+
+    uint8_t  class = mods & MOD_BIT(KC_RALT) ? ALT_REPEAT_ALTGR : mods & MOD_MASK_SHIFT ? ALT_REPEAT_SHIFT : ALT_REPEAT_PLAIN;
+    uint16_t next  = pgm_read_word(&alt_repeat[keycode][class]);
+    return next ? next : KC_TRNS;
+}
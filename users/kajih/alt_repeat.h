@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Completions for QMK's alternate repeat key (QK_AREP), looked up in a
+// PROGMEM table indexed by the previous key's basic keycode and whether it
+// was typed plain, shifted or with AltGr: SE_LPRN gives SE_RPRN, SE_MINS
+// gives SE_RABK. Keys without an entry fall back to QMK's own alternates
+// (arrows, Home/End, Backspace/Delete, ...), as do keys typed with Ctrl, Alt
+// or GUI.
+enum alt_repeat_class {
+    ALT_REPEAT_PLAIN,
+    ALT_REPEAT_SHIFT,
+    ALT_REPEAT_ALTGR,
+    ALT_REPEAT_CLASSES,
+};
+
+// Basic keycodes up to the ISO <> key have entries
+#define ALT_REPEAT_KEYS (KC_NUBS + 1)
+
+#define ALT_REPEAT_CLASS(kc) (((kc) & QK_RALT) == QK_RALT ? ALT_REPEAT_ALTGR : ((kc) & QK_LSFT) ? ALT_REPEAT_SHIFT : ALT_REPEAT_PLAIN)
+
+// Table entry: next is sent by QK_AREP after prev
+#define ALT_REPEAT(prev, next) [(prev) & 0xFF][ALT_REPEAT_CLASS(prev)] = (next)
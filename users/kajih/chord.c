@@ -0,0 +1,180 @@
+#include "chord.h"
+
+#define CHORD_NONE 0xFF
+
+// Matrix mask of every chord
+static uint64_t chord_mask[CHORD_MAX];
+static uint8_t  chord_total;
+
+// Chords containing each matrix position: cand[cand_start[pos] .. cand_start[pos + 1]]
+static uint16_t cand_start[GEO_POSITIONS + 1];
+static uint8_t  cand[CHORD_MAX * CHORD_KEYS_MAX];
+
+// Presses held back while a chord may still complete
+static keyevent_t buffer[CHORD_KEYS_MAX];
+static uint8_t    buffered;
+static uint64_t   pressed;
+static uint8_t    first;
+static uint8_t    matched = CHORD_NONE;
+static uint16_t   started;
+
+// Chord currently sent and the keys whose releases it still owns
+static uint8_t  active = CHORD_NONE;
+static uint64_t active_keys;
+
+static bool replaying;
+
+static uint16_t chord_keycode(uint8_t index) {
+    return pgm_read_word(&chords[index].keycode);
+}
+
+void chord_init(void) {
+    uint8_t count[GEO_POSITIONS] = {0};
+
+    chord_total = chord_count < CHORD_MAX ? chord_count : CHORD_MAX;
+    for (uint8_t i = 0; i < chord_total; i++) {
+        chord_t chord;
+        memcpy_P(&chord, &chords[i], sizeof(chord));
+
+        chord_mask[i] = 0;
+        for (uint8_t k = 0; k < chord.count && k < CHORD_KEYS_MAX; k++) {
+            uint8_t pos = geo_pos(chord.keys[k]);
+            if (pos != GEO_NONE && !(chord_mask[i] & GEO_BIT(pos))) {
+                chord_mask[i] |= GEO_BIT(pos);
+                count[pos]++;
+            }
+        }
+    }
+
+    cand_start[0] = 0;
+    for (uint8_t pos = 0; pos < GEO_POSITIONS; pos++) {
+        cand_start[pos + 1] = cand_start[pos] + count[pos];
+        count[pos]          = 0;
+    }
+    for (uint8_t i = 0; i < chord_total; i++) {
+        for (uint8_t pos = 0; pos < GEO_POSITIONS; pos++) {
+            if (chord_mask[i] & GEO_BIT(pos)) {
+                cand[cand_start[pos] + count[pos]++] = i;
+            }
+        }
+    }
+}
+
+// Checked when a chord could complete, the layer is the one its keys are on
+static bool chord_on_layer(uint8_t index) {
+    layer_state_t layers;
+    memcpy_P(&layers, &chords[index].layers, sizeof(layers));
+    uint8_t top = get_highest_layer(layer_state | default_layer_state);
+    return layers ? (layers >> top) & 1 : top == get_highest_layer(default_layer_state);
+}
+
+static void chord_clear(void) {
+    buffered = 0;
+    pressed  = 0;
+    matched  = CHORD_NONE;
+}
+
+static void chord_fire(uint8_t index) {
+    active      = index;
+    active_keys = chord_mask[index];
+    register_code16(chord_keycode(index));
+    chord_clear();
+}
+
+// Send the held back presses through the normal pipeline, in order
+static void chord_replay(void) {
+    replaying = true;
+    for (uint8_t i = 0; i < buffered; i++) {
+        action_exec(buffer[i]);
+    }
+    replaying = false;
+    chord_clear();
+}
+
+static void chord_resolve(void) {
+    if (matched != CHORD_NONE) {
+        chord_fire(matched);
+    } else {
+        chord_replay();
+    }
+}
+
+static bool chord_release(uint64_t bit) {
+    if (!(active_keys & bit)) {
+        return true;
+    }
+    active_keys &= ~bit;
+    // The chord ends with the first key let go, the others are swallowed
+    if (active != CHORD_NONE) {
+        unregister_code16(chord_keycode(active));
+        active = CHORD_NONE;
+    }
+    return false;
+}
+
+bool chord_process(keyrecord_t *record) {
+    if (replaying || !IS_KEYEVENT(record->event)) {
+        return true;
+    }
+
+    uint8_t  pos = GEO_POS(record->event.key.row, record->event.key.col);
+    uint64_t bit = GEO_BIT(pos);
+
+    if (!record->event.pressed) {
+        // Held back presses go first, a release of a key pressed before them
+        // included, or QMK would see the two out of order
+        if (buffered) {
+            chord_resolve();
+        }
+        return chord_release(bit);
+    }
+
+    if (buffered == 0) {
+        if (cand_start[pos] == cand_start[pos + 1]) {
+            return true;
+        }
+        first   = pos;
+        started = record->event.time;
+    }
+
+    // Every chord still possible contains the first key, so its list is enough
+    uint64_t next  = pressed | bit;
+    uint8_t  match = CHORD_NONE;
+    bool     more  = false;
+    for (uint16_t i = cand_start[first]; i < cand_start[first + 1]; i++) {
+        if (!chord_on_layer(cand[i])) {
+            continue;
+        }
+        uint64_t mask = chord_mask[cand[i]];
+        if ((mask & next) == next) {
+            if (mask == next) {
+                match = cand[i];
+            } else {
+                more = true;
+            }
+        }
+    }
+
+    if (match == CHORD_NONE && !more) {
+        chord_resolve();
+        return true;
+    }
+
+    buffer[buffered++] = record->event;
+    pressed            = next;
+    matched            = match;
+    if (match != CHORD_NONE && !more) {
+        chord_fire(match);
+    }
+    return false;
+}
+
+bool chord_replaying(void) {
+    return replaying;
+}
+
+void chord_task(void) {
+    if (buffered && timer_elapsed(started) >= CHORD_TERM) {
+        chord_resolve();
+    }
+}
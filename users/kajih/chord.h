@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+#include "geometry.h"
+
+// Combos matched on matrix positions. A press is only checked against the
+// chords that contain its key, from a per-position index built at init.
+
+// Time the first key waits for the rest of its chord
+#ifndef CHORD_TERM
+#    define CHORD_TERM 40
+#endif
+#ifndef CHORD_KEYS_MAX
+#    define CHORD_KEYS_MAX 4
+#endif
+#ifndef CHORD_MAX
+#    define CHORD_MAX 128
+#endif
+
+_Static_assert(CHORD_MAX <= 255, "chord indices are stored as uint8_t");
+
+typedef struct {
+    uint16_t      keycode;
+    uint8_t       count;
+    uint8_t       keys[CHORD_KEYS_MAX]; // layout indices, see geometry.h
+    layer_state_t layers;               // layers it fires on, 0 for the base layers only
+} chord_t;
+
+// CHORD(KC_ESC, 1, 2) sends Escape while layout keys 1 and 2 are held together,
+// as long as no layer above the default one is on
+#define CHORD(kc, ...) CHORD_ON(0, kc, __VA_ARGS__)
+// CHORD_ON(1 << _NAV, KC_ESC, 1, 2) only fires while _NAV is the top layer
+#define CHORD_ON(mask, kc, ...) \
+    { .keycode = (kc), .count = sizeof((const uint8_t[]){__VA_ARGS__}), .keys = {__VA_ARGS__}, .layers = (mask) }
+
+// Defined by the keymap
+extern const chord_t chords[];
+extern const uint8_t chord_count;
+
+void chord_init(void);
+bool chord_process(keyrecord_t *record);
+void chord_task(void);
+// True while held back presses are being sent on, for hooks that count presses
+bool chord_replaying(void);
@@ -1,2 +1,14 @@
 #pragma once
 #define OLED_FONT_H "glcdfont_kajih.c"
+#include "glcdfont_kajih.h"
+
+#ifdef USAGE_STATS_ENABLE
+// sizeof(usage_t) with 50 keys and 16 layers
+#    define EECONFIG_USER_DATA_SIZE 268
+#endif
+
+#ifdef OLED_FLUSH_ENABLE
+// Small blocks, one per oled_task, the rest is paced by oled_flush_task
+#    define OLED_BLOCK_TYPE uint32_t
+#    define OLED_UPDATE_PROCESS_LIMIT 1
+#endif
@@ -0,0 +1,38 @@
+#include "flow_tap.h"
+
+#ifndef FLOW_TAP_TERM
+#    error "FLOW_TAP_ENABLE needs FLOW_TAP_TERM in config.h"
+#endif
+
+__attribute__((weak)) const uint8_t PROGMEM flow_tap_terms[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+
+// Keys inside a word on a Swedish host: A-Z, å, ä, ö and the apostrophe
+static bool is_letter(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    switch (keycode) {
+        case KC_A ... KC_Z:
+        case KC_LBRC:
+        case KC_SCLN:
+        case KC_QUOT:
+        case KC_BSLS:
+        case KC_NUHS:
+            return true;
+    }
+    return false;
+}
+
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+    // As in QMK's default, a shortcut in progress keeps the hold-tap decision
+    if (get_mods() & (MOD_MASK_CG | MOD_BIT_LALT)) {
+        return 0;
+    }
+    if (!IS_QK_MOD_TAP(keycode) || !is_letter(keycode) || !is_letter(prev_keycode)) {
+        return 0;
+    }
+    uint8_t term = pgm_read_byte(&flow_tap_terms[record->event.key.row][record->event.key.col]);
+    return term ? term : FLOW_TAP_TERM;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Streak mode for home-row mods on top of QMK's Flow Tap: a mod-tap on a
+// letter pressed within its window after a letter resolves as a tap at once,
+// without waiting out the tapping term. Layer-taps, keys following anything
+// but a letter and presses while Ctrl, GUI or left Alt are held keep the
+// normal hold-tap arbitration.
+//
+// Windows are in ms per matrix position. The keymap may define the table
+// with LAYOUT(), 0 means FLOW_TAP_TERM. Without a table every key uses
+// FLOW_TAP_TERM.
+extern const uint8_t flow_tap_terms[MATRIX_ROWS][MATRIX_COLS];
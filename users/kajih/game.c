@@ -0,0 +1,77 @@
+#include "game.h"
+#include "kajih.h"
+
+static bool active;
+
+// Keycode registered per matrix position, released with that key whatever
+// the mode is by then
+static uint16_t down[GEO_POSITIONS];
+
+#ifdef RGB_MATRIX_ENABLE
+static uint8_t saved_mode;
+#endif
+
+__attribute__((weak)) uint16_t game_tap_dance_keycode(uint8_t index) {
+    return KC_NO;
+}
+
+static void game_toggle(void) {
+    active = !active;
+#ifdef RGB_MATRIX_ENABLE
+    if (active) {
+        saved_mode = rgb_matrix_get_mode();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    } else {
+        rgb_matrix_mode_noeeprom(saved_mode);
+    }
+#endif
+}
+
+bool game_process(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == GAME) {
+        if (record->event.pressed) {
+            game_toggle();
+        }
+        return false;
+    }
+    if (!IS_KEYEVENT(record->event)) {
+        return true;
+    }
+
+    uint8_t pos = GEO_POS(record->event.key.row, record->event.key.col);
+    if (!record->event.pressed) {
+        if (!down[pos]) {
+            return true;
+        }
+        unregister_code16(down[pos]);
+        down[pos] = KC_NO;
+        return false;
+    }
+    if (!active) {
+        return true;
+    }
+
+    if (IS_QK_MOD_TAP(keycode)) {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_TAP_DANCE(keycode)) {
+        keycode = game_tap_dance_keycode(QK_TAP_DANCE_GET_INDEX(keycode));
+    } else if (!IS_QK_BASIC(keycode) && !IS_QK_MODS(keycode)) {
+        return true;
+    }
+
+    if (keycode != KC_NO) {
+        register_code16(keycode);
+        down[pos] = keycode;
+    }
+    return false;
+}
+
+bool game_mode_active(void) {
+    return active;
+}
+
+void game_render(void) {
+    oled_write_P(active ? PSTR(" Game") : PSTR("     "), false);
+}
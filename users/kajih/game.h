@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Game profile, toggled with GAME. While it is on every key press is sent
+// from pre_process_record as its plain keycode: mod-taps and layer-taps as
+// their tap key, tap dances as what game_tap_dance_keycode() gives (nothing
+// by default), so nothing waits in the tapping buffer, for a chord or for a
+// second tap. The report goes out in the scan that saw the press. Layer keys
+// and other special keycodes still take the normal path, minus chords, the
+// leader and the recorder. Reactive RGB is swapped for a solid colour.
+
+bool game_process(uint16_t keycode, keyrecord_t *record);
+bool game_mode_active(void);
+void game_render(void);
+
+// Plain keycode for the keymap's TD(index) while gaming, KC_NO to drop it
+uint16_t game_tap_dance_keycode(uint8_t index);
@@ -0,0 +1,43 @@
+#include "geometry.h"
+
+// Layout index + 1 for every matrix position, 0 (KC_NO) where there is no key
+// clang-format off
+static const uint8_t PROGMEM layout_index[MATRIX_ROWS][MATRIX_COLS] = LAYOUT(
+     1,  2,  3,  4,  5,  6,                          7,  8,  9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18,                         19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32,         33, 34, 35, 36, 37, 38, 39, 40,
+                41, 42, 43, 44, 45,         46, 47, 48, 49, 50
+);
+// clang-format on
+
+uint8_t geo_index(uint8_t pos) {
+    if (pos >= GEO_POSITIONS) {
+        return GEO_NONE;
+    }
+    return pgm_read_byte(&layout_index[0][0] + pos) - 1;
+}
+
+// Every LAYOUT() row is split evenly between the halves
+char geo_hand(uint8_t index) {
+    static const uint8_t row_start[] = {0, 12, 24, GEO_THUMBS, GEO_KEYS};
+    if (index >= GEO_THUMBS) {
+        return '*';
+    }
+    uint8_t row = 0;
+    while (index >= row_start[row + 1]) {
+        row++;
+    }
+    return index - row_start[row] < (row_start[row + 1] - row_start[row]) / 2 ? 'L' : 'R';
+}
+
+uint8_t geo_pos(uint8_t index) {
+    if (index >= GEO_KEYS) {
+        return GEO_NONE;
+    }
+    for (uint8_t pos = 0; pos < GEO_POSITIONS; pos++) {
+        if (geo_index(pos) == index) {
+            return pos;
+        }
+    }
+    return GEO_NONE;
+}
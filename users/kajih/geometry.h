@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Keys are numbered in LAYOUT() order:
+//
+//   0  1  2  3  4  5                          6  7  8  9 10 11
+//  12 13 14 15 16 17                         18 19 20 21 22 23
+//  24 25 26 27 28 29 30 31           32 33 34 35 36 37 38 39
+//           40 41 42 43 44           45 46 47 48 49
+//
+// Matrix positions are row * MATRIX_COLS + col, one bit each in a 64 bit mask.
+#define GEO_KEYS 50
+#define GEO_THUMBS 40 // first thumb row index
+#define GEO_NONE 0xFF
+#define GEO_POSITIONS (MATRIX_ROWS * MATRIX_COLS)
+#define GEO_POS(row, col) ((uint8_t)((row) * MATRIX_COLS + (col)))
+#define GEO_BIT(pos) ((uint64_t)1 << (pos))
+
+_Static_assert(GEO_POSITIONS <= 64, "matrix positions must fit a uint64_t mask");
+
+// Layout index to matrix position, GEO_NONE if out of range
+uint8_t geo_pos(uint8_t index);
+// Matrix position to layout index, GEO_NONE where the matrix has no key
+uint8_t geo_index(uint8_t pos);
+// 'L' or 'R' for the half a layout index sits on, '*' for the thumb rows
+char geo_hand(uint8_t index);
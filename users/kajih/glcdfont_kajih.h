@@ -0,0 +1,5 @@
+// Generated by tools/fontgen.py, do not edit.
+#pragma once
+
+#define OLED_FONT_START 0x20
+#define OLED_FONT_END 0x7E
@@ -0,0 +1,201 @@
+#include "hid_protocol.h"
+#include "offhand.h"
+#include "scan_stats.h"
+#include "timer_us.h"
+#ifdef OLED_FLUSH_ENABLE
+#    include "oled_flush.h"
+#endif
+#ifdef USAGE_STATS_ENABLE
+#    include "usage.h"
+#endif
+#ifdef HOLDTAP_STATS_ENABLE
+#    include "holdtap_stats.h"
+#endif
+#ifdef MISFIRE_STATS_ENABLE
+#    include "misfire.h"
+#endif
+#ifdef REPORT_BATCH_ENABLE
+#    include "report_batch.h"
+#endif
+
+#include "quantum.h"
+#include "raw_hid.h"
+
+#include <string.h>
+
+static uint8_t hid_hello(const uint8_t *args, uint8_t *reply) {
+    reply[0] = HID_PROTOCOL_VERSION;
+    reply[1] = HID_PACKET_SIZE;
+    reply[2] = OFFHAND_COLS;
+    reply[3] = OFFHAND_ROWS;
+    reply[4] = HID_OP_COUNT;
+    return HID_STATUS_OK;
+}
+
+static uint8_t hid_text_write(const uint8_t *args, uint8_t *reply) {
+    uint8_t length = args[0];
+    if (length > OFFHAND_WRITE_MAX) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    return offhand_send(HID_OP_TEXT_WRITE, args, length + 1) ? HID_STATUS_OK : HID_STATUS_SPLIT_ERROR;
+}
+
+static uint8_t hid_text_clear(const uint8_t *args, uint8_t *reply) {
+    return offhand_send(HID_OP_TEXT_CLEAR, args, 0) ? HID_STATUS_OK : HID_STATUS_SPLIT_ERROR;
+}
+
+static uint8_t hid_cursor_set(const uint8_t *args, uint8_t *reply) {
+    if (args[0] >= OFFHAND_COLS || args[1] >= OFFHAND_ROWS) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    return offhand_send(HID_OP_CURSOR_SET, args, 2) ? HID_STATUS_OK : HID_STATUS_SPLIT_ERROR;
+}
+
+static uint8_t hid_stats_get(const uint8_t *args, uint8_t *reply) {
+    hid_put_u32(&reply[0], scan_stats.scan_rate);
+    hid_put_u16(&reply[4], scan_stats.latency_max_us);
+    hid_put_u16(&reply[6], scan_stats.split_ok);
+    hid_put_u16(&reply[8], scan_stats.split_fail);
+    for (uint8_t i = 0; i < SCAN_STATS_BUCKETS; i++) {
+        hid_put_u16(&reply[10 + i * 2], scan_stats.latency[i]);
+    }
+#ifdef OLED_FLUSH_ENABLE
+    hid_put_u16(&reply[26], oled_flush_stall_max_us);
+#endif
+#ifdef TIMER_US_COARSE
+    reply[28] = HID_STATS_NO_LOOP_TIMES;
+#endif
+
+    if (args[0] & HID_STATS_RESET) {
+        scan_stats_reset();
+#ifdef OLED_FLUSH_ENABLE
+        oled_flush_stall_max_us = 0;
+#endif
+    }
+    return HID_STATUS_OK;
+}
+
+#ifdef USAGE_STATS_ENABLE
+// Pages through the raw usage_t: args u16 offset, u8 flags.
+// Reply u16 total size, u8 length, then up to 26 bytes from offset.
+static uint8_t hid_usage_get(const uint8_t *args, uint8_t *reply) {
+    uint16_t offset = hid_get_u16(&args[0]);
+    if (offset > sizeof(usage)) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    uint8_t length = HID_RES_PAYLOAD - 3;
+    if (sizeof(usage) - offset < length) {
+        length = sizeof(usage) - offset;
+    }
+    hid_put_u16(&reply[0], sizeof(usage));
+    reply[2] = length;
+    memcpy(&reply[3], (const uint8_t *)&usage + offset, length);
+
+    if (args[2] & HID_USAGE_RESET) {
+        usage_reset();
+    }
+    return HID_STATUS_OK;
+}
+#endif
+
+#ifdef HOLDTAP_STATS_ENABLE
+// One histogram per request: args slot, kind (holdtap_kind), flags.
+// Reply slots used, LAYOUT index, keycode u16, then the buckets as u16.
+static uint8_t hid_holdtap_get(const uint8_t *args, uint8_t *reply) {
+    uint8_t slot = args[0], kind = args[1];
+    if (kind >= HOLDTAP_KINDS || (slot >= holdtap_used && holdtap_used)) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    reply[0] = holdtap_used;
+    if (slot < holdtap_used) {
+        reply[1] = holdtap_slots[slot].index;
+        hid_put_u16(&reply[2], holdtap_slots[slot].keycode);
+        for (uint8_t i = 0; i < HOLDTAP_BUCKETS; i++) {
+            hid_put_u16(&reply[4 + i * 2], holdtap_slots[slot].hist[kind][i]);
+        }
+    }
+
+    if (args[2] & HID_HOLDTAP_RESET) {
+        holdtap_reset();
+    }
+    return HID_STATUS_OK;
+}
+#endif
+
+#ifdef MISFIRE_STATS_ENABLE
+// Counters of one rule, 13 keys per request: args rule, first LAYOUT index, flags.
+// Reply: rule count, key count, first index, u16 counters.
+#    define HID_MISFIRE_PAGE ((HID_RES_PAYLOAD - 3) / 2)
+static uint8_t hid_misfire_get(const uint8_t *args, uint8_t *reply) {
+    uint8_t rule = args[0], first = args[1];
+    if (rule >= MISFIRE_RULES || first >= GEO_KEYS) {
+        return HID_STATUS_BAD_ARGS;
+    }
+    reply[0] = MISFIRE_RULES;
+    reply[1] = GEO_KEYS;
+    reply[2] = first;
+    for (uint8_t i = 0; i < HID_MISFIRE_PAGE && first + i < GEO_KEYS; i++) {
+        hid_put_u16(&reply[3 + i * 2], misfire_counts[rule][first + i]);
+    }
+
+    if (args[2] & HID_MISFIRE_RESET) {
+        misfire_reset();
+    }
+    return HID_STATUS_OK;
+}
+#endif
+
+#ifdef REPORT_BATCH_ENABLE
+// Args flags. Reply u32 reports submitted, u32 reports sent, u32 key presses.
+static uint8_t hid_batch_get(const uint8_t *args, uint8_t *reply) {
+    hid_put_u32(&reply[0], report_batch_stats.submitted);
+    hid_put_u32(&reply[4], report_batch_stats.sent);
+    hid_put_u32(&reply[8], report_batch_stats.presses);
+
+    if (args[0] & HID_BATCH_RESET) {
+        report_batch_reset();
+    }
+    return HID_STATUS_OK;
+}
+#endif
+
+// Indexed by opcode, so dispatch costs the same for every command.
+// Opcodes of features left out of the build stay NULL and answer UNKNOWN_OP.
+static const hid_handler_t hid_handlers[HID_OP_COUNT] = {
+    [HID_OP_HELLO]      = hid_hello,
+    [HID_OP_TEXT_WRITE] = hid_text_write,
+    [HID_OP_TEXT_CLEAR] = hid_text_clear,
+    [HID_OP_CURSOR_SET] = hid_cursor_set,
+    [HID_OP_STATS_GET]  = hid_stats_get,
+#ifdef USAGE_STATS_ENABLE
+    [HID_OP_USAGE_GET]  = hid_usage_get,
+#endif
+#ifdef HOLDTAP_STATS_ENABLE
+    [HID_OP_HOLDTAP_GET] = hid_holdtap_get,
+#endif
+#ifdef MISFIRE_STATS_ENABLE
+    [HID_OP_MISFIRE_GET] = hid_misfire_get,
+#endif
+#ifdef REPORT_BATCH_ENABLE
+    [HID_OP_BATCH_GET] = hid_batch_get,
+#endif
+};
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    uint8_t request[HID_PACKET_SIZE] = {0};
+    uint8_t reply[HID_PACKET_SIZE]   = {0};
+
+    if (length < HID_REQ_HEADER || !is_keyboard_master()) {
+        return;
+    }
+    // Short packets are zero padded so handlers can always read a full payload
+    memcpy(request, data, length < sizeof(request) ? length : sizeof(request));
+
+    uint8_t opcode = request[0];
+    reply[0]       = opcode;
+    reply[1]       = request[1];
+    reply[2]       = opcode < HID_OP_COUNT && hid_handlers[opcode] ? hid_handlers[opcode](&request[HID_REQ_HEADER], &reply[HID_RES_HEADER]) : HID_STATUS_UNKNOWN_OP;
+
+    dprintf("raw_hid_receive - op %u seq %u status %u\n", opcode, reply[1], reply[2]);
+    raw_hid_send(reply, sizeof(reply));
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+// Raw HID command protocol, versioned so host tooling can refuse to talk to
+// firmware it does not understand.
+//
+// Request:  [opcode][seq][payload...]
+// Response: [opcode][seq][status][payload...]
+//
+// Every request is answered with exactly one response echoing the opcode and
+// sequence number, which doubles as the ack. Multi byte values are little endian.
+#define HID_PROTOCOL_VERSION 1
+
+#define HID_PACKET_SIZE 32
+#define HID_REQ_HEADER 2
+#define HID_RES_HEADER 3
+#define HID_REQ_PAYLOAD (HID_PACKET_SIZE - HID_REQ_HEADER)
+#define HID_RES_PAYLOAD (HID_PACKET_SIZE - HID_RES_HEADER)
+
+enum hid_opcode {
+    HID_OP_HELLO = 0,
+    HID_OP_TEXT_WRITE,
+    HID_OP_TEXT_CLEAR,
+    HID_OP_CURSOR_SET,
+    HID_OP_STATS_GET,
+    HID_OP_USAGE_GET,
+    HID_OP_HOLDTAP_GET,
+    HID_OP_MISFIRE_GET,
+    HID_OP_BATCH_GET,
+    HID_OP_COUNT,
+};
+
+enum hid_status {
+    HID_STATUS_OK = 0,
+    HID_STATUS_UNKNOWN_OP,
+    HID_STATUS_BAD_ARGS,
+    HID_STATUS_SPLIT_ERROR,
+};
+
+// HID_OP_STATS_GET flags
+#define HID_STATS_RESET (1 << 0)
+// HID_OP_STATS_GET reply flags
+#define HID_STATS_NO_LOOP_TIMES (1 << 0)
+
+// HID_OP_USAGE_GET flags
+#define HID_USAGE_RESET (1 << 0)
+
+// HID_OP_HOLDTAP_GET flags
+#define HID_HOLDTAP_RESET (1 << 0)
+
+// HID_OP_MISFIRE_GET flags
+#define HID_MISFIRE_RESET (1 << 0)
+
+// HID_OP_BATCH_GET flags
+#define HID_BATCH_RESET (1 << 0)
+
+// Handlers get the request payload and fill in the response payload, returning a status
+typedef uint8_t (*hid_handler_t)(const uint8_t *args, uint8_t *reply);
+
+static inline uint16_t hid_get_u16(const uint8_t *in) {
+    return in[0] | (uint16_t)in[1] << 8;
+}
+
+static inline void hid_put_u16(uint8_t *out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+static inline void hid_put_u32(uint8_t *out, uint32_t value) {
+    hid_put_u16(out, value & 0xFFFF);
+    hid_put_u16(out + 2, value >> 16);
+}
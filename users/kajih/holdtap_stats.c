@@ -0,0 +1,78 @@
+#include "holdtap_stats.h"
+#include "geometry.h"
+
+#include <string.h>
+
+holdtap_slot_t holdtap_slots[HOLDTAP_SLOTS];
+uint8_t        holdtap_used;
+
+// Per key in flight: press time from before tapping, resolution from after
+static uint16_t pressed_at[GEO_KEYS];
+static uint8_t  resolved[GEO_KEYS]; // holdtap_kind + 1, 0 while undecided
+
+static inline bool is_holdtap(uint16_t keycode) {
+    return IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode);
+}
+
+static inline uint8_t record_index(keyrecord_t *record) {
+    return geo_index(GEO_POS(record->event.key.row, record->event.key.col));
+}
+
+static holdtap_slot_t *slot_for(uint8_t index, uint16_t keycode) {
+    for (uint8_t i = 0; i < holdtap_used; i++) {
+        if (holdtap_slots[i].index == index && holdtap_slots[i].keycode == keycode) {
+            return &holdtap_slots[i];
+        }
+    }
+    if (holdtap_used == HOLDTAP_SLOTS) {
+        return NULL;
+    }
+    holdtap_slot_t *slot = &holdtap_slots[holdtap_used++];
+    slot->index          = index;
+    slot->keycode        = keycode;
+    return slot;
+}
+
+// Raw press time, before the tapping code holds the event back
+void holdtap_pre_process(uint16_t keycode, keyrecord_t *record) {
+    uint8_t index = record_index(record);
+    if (record->event.pressed && index != GEO_NONE && is_holdtap(keycode)) {
+        pressed_at[index] = record->event.time;
+        resolved[index]   = 0;
+    }
+}
+
+// The press comes through once tap or hold is decided, the release after it
+void holdtap_post_process(uint16_t keycode, keyrecord_t *record) {
+    uint8_t index = record_index(record);
+    if (index == GEO_NONE || !is_holdtap(keycode)) {
+        return;
+    }
+    if (record->event.pressed) {
+        uint8_t kind    = record->tap.count ? HOLDTAP_TAP : HOLDTAP_HOLD;
+        resolved[index] = kind + (record->tap.interrupted ? 1 : 0) + 1;
+        return;
+    }
+    if (!resolved[index]) {
+        return;
+    }
+
+    holdtap_slot_t *slot = slot_for(index, keycode);
+    if (slot) {
+        uint16_t duration = record->event.time - pressed_at[index];
+        uint8_t  bucket   = 0;
+        for (duration >>= HOLDTAP_BUCKET_SHIFT; duration && bucket < HOLDTAP_BUCKETS - 1; duration >>= 1) {
+            bucket++;
+        }
+        uint16_t *count = &slot->hist[resolved[index] - 1][bucket];
+        if (*count < UINT16_MAX) {
+            (*count)++;
+        }
+    }
+    resolved[index] = 0;
+}
+
+void holdtap_reset(void) {
+    memset(holdtap_slots, 0, sizeof(holdtap_slots));
+    holdtap_used = 0;
+}
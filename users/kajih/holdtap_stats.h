@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Press duration histograms for mod-tap and layer-tap keys, split by how the
+// key resolved and whether another key was pressed while it was down.
+// Bucket 0 is < 16ms and every following bucket doubles, the last is open ended.
+#define HOLDTAP_BUCKETS 8
+#define HOLDTAP_BUCKET_SHIFT 4
+
+#ifndef HOLDTAP_SLOTS
+#    define HOLDTAP_SLOTS 16
+#endif
+
+enum holdtap_kind {
+    HOLDTAP_TAP = 0,
+    HOLDTAP_TAP_INTERRUPTED,
+    HOLDTAP_HOLD,
+    HOLDTAP_HOLD_INTERRUPTED,
+    HOLDTAP_KINDS,
+};
+
+typedef struct {
+    uint8_t  index; // LAYOUT index
+    uint16_t keycode;
+    uint16_t hist[HOLDTAP_KINDS][HOLDTAP_BUCKETS];
+} holdtap_slot_t;
+
+extern holdtap_slot_t holdtap_slots[HOLDTAP_SLOTS];
+extern uint8_t        holdtap_used;
+
+void holdtap_pre_process(uint16_t keycode, keyrecord_t *record);
+void holdtap_post_process(uint16_t keycode, keyrecord_t *record);
+void holdtap_reset(void);
@@ -0,0 +1,144 @@
+#include "kajih.h"
+
+__attribute__((weak)) void keyboard_post_init_keymap(void) {}
+
+__attribute__((weak)) void housekeeping_task_keymap(void) {}
+
+__attribute__((weak)) bool oled_task_keymap(void) {
+    return true;
+}
+
+__attribute__((weak)) bool pre_process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+__attribute__((weak)) bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+__attribute__((weak)) void post_process_record_keymap(uint16_t keycode, keyrecord_t *record) {}
+
+#ifdef CHORDAL_HOLD
+// Hands come from the LAYOUT() geometry, thumbs can hold with either hand
+char chordal_hold_handedness(keypos_t key) {
+    uint8_t index = geo_index(GEO_POS(key.row, key.col));
+    return index == GEO_NONE ? '*' : geo_hand(index);
+}
+#endif
+
+#ifdef HOLD_ON_OTHER_KEY_PRESS_PER_KEY
+// Mod-taps decide on the next press, chordal hold makes a same hand press a
+// tap first. Layer-tap thumbs keep the tapping term so space rolls stay taps.
+bool get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record) {
+    return IS_QK_MOD_TAP(keycode);
+}
+#endif
+
+void keyboard_post_init_user(void) {
+#ifdef CHORD_ENABLE
+    chord_init();
+#endif
+#ifdef USAGE_STATS_ENABLE
+    usage_init();
+#endif
+#ifdef HID_PROTOCOL_ENABLE
+    offhand_init();
+#endif
+    keyboard_post_init_keymap();
+}
+
+void housekeeping_task_user(void) {
+#ifdef HID_PROTOCOL_ENABLE
+    scan_stats_task();
+#endif
+#ifdef CHORD_ENABLE
+    chord_task();
+#endif
+#ifdef MACRO_REC_ENABLE
+    macro_rec_task();
+#endif
+#ifdef LEADER_TRIE_ENABLE
+    leader_task();
+#endif
+#ifdef USAGE_STATS_ENABLE
+    usage_task();
+#endif
+#ifdef NAV_REPEAT_ENABLE
+    nav_repeat_task();
+#endif
+#ifdef REPORT_BATCH_ENABLE
+    // After every task that may send keys, so each loop ends with one report
+    report_batch_task();
+#endif
+#ifdef OLED_FLUSH_ENABLE
+    oled_flush_task();
+#endif
+    housekeeping_task_keymap();
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+#ifdef USAGE_STATS_ENABLE
+    usage_record(record);
+#endif
+#ifdef GAME_MODE_ENABLE
+    if (!game_process(keycode, record)) {
+        return false;
+    }
+    // Whatever game mode leaves to QMK skips the modules that hold keys back
+    if (game_mode_active()) {
+        return true;
+    }
+#endif
+#ifdef CHORD_ENABLE
+    if (!chord_process(record)) {
+        return false;
+    }
+#endif
+#ifdef HOLDTAP_STATS_ENABLE
+    holdtap_pre_process(keycode, record);
+#endif
+#ifdef MACRO_REC_ENABLE
+    if (!macro_rec_process(keycode, record)) {
+        return false;
+    }
+#endif
+#ifdef LEADER_TRIE_ENABLE
+    if (!leader_process(keycode, record)) {
+        return false;
+    }
+#endif
+    return pre_process_record_keymap(keycode, record);
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+#ifdef ONE_SHOT_ENABLE
+    if (!one_shot_process(keycode, record)) {
+        return false;
+    }
+#endif
+#ifdef NAV_REPEAT_ENABLE
+    if (!nav_repeat_process(keycode, record)) {
+        return false;
+    }
+#endif
+    return process_record_keymap(keycode, record);
+}
+
+void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+#ifdef HOLDTAP_STATS_ENABLE
+    holdtap_post_process(keycode, record);
+#endif
+#ifdef MISFIRE_STATS_ENABLE
+    misfire_post_process(keycode, record);
+#endif
+#ifdef TYPO_FIX_ENABLE
+    typo_post_process(keycode, record);
+#endif
+    post_process_record_keymap(keycode, record);
+}
+
+#ifdef OLED_ENABLE
+bool oled_task_user(void) {
+    return oled_task_keymap();
+}
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "geometry.h"
+#include "report_tap.h"
+#ifdef CHORD_ENABLE
+#    include "chord.h"
+#endif
+#ifdef USAGE_STATS_ENABLE
+#    include "usage.h"
+#endif
+#ifdef HOLDTAP_STATS_ENABLE
+#    include "holdtap_stats.h"
+#endif
+#ifdef FLOW_TAP_ENABLE
+#    include "flow_tap.h"
+#endif
+#ifdef MISFIRE_STATS_ENABLE
+#    include "misfire.h"
+#endif
+#ifdef SEND_SE_ENABLE
+#    include "send_se.h"
+#endif
+#ifdef MACRO_REC_ENABLE
+#    include "macro_rec.h"
+#endif
+#ifdef LEADER_TRIE_ENABLE
+#    include "leader.h"
+#endif
+#ifdef TYPO_FIX_ENABLE
+#    include "typo.h"
+#endif
+#ifdef REPEAT_KEY_ENABLE
+#    include "alt_repeat.h"
+#endif
+#ifdef ONE_SHOT_ENABLE
+#    include "one_shot.h"
+#endif
+#ifdef GAME_MODE_ENABLE
+#    include "game.h"
+#endif
+#ifdef NAV_REPEAT_ENABLE
+#    include "nav_repeat.h"
+#endif
+#ifdef REPORT_BATCH_ENABLE
+#    include "report_batch.h"
+#endif
+#ifdef OLED_ART_ENABLE
+#    include "oled_art.h"
+#endif
+#ifdef OLED_FLUSH_ENABLE
+#    include "oled_flush.h"
+#endif
+#ifdef HID_PROTOCOL_ENABLE
+#    include "hid_protocol.h"
+#    include "offhand.h"
+#    include "scan_stats.h"
+#endif
+
+// Userspace keycodes, keymaps start theirs at USER_SAFE_RANGE
+enum userspace_keycodes {
+    MREC = SAFE_RANGE,
+    MPLAY,
+    MFAST,
+    LEAD,
+    OSCNCL,
+    GAME,
+    // One-shot mods and layers, OSMOD(mod) and OSLAYER(layer) in one_shot.h
+    ONE_SHOT_MOD,
+    ONE_SHOT_MOD_MAX = ONE_SHOT_MOD + 0x1F,
+    ONE_SHOT_LAYER,
+    ONE_SHOT_LAYER_MAX = ONE_SHOT_LAYER + 0x1F,
+    USER_SAFE_RANGE,
+};
+
+// Keymap level hooks, called from the userspace versions of the _user hooks
+void keyboard_post_init_keymap(void);
+void housekeeping_task_keymap(void);
+bool oled_task_keymap(void);
+bool pre_process_record_keymap(uint16_t keycode, keyrecord_t *record);
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record);
+void post_process_record_keymap(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,105 @@
+#include "leader.h"
+#include "kajih.h"
+
+#include <string.h>
+
+#include "keymap_swedish.h"
+#include "leader_trie.h"
+
+static bool     active;
+static uint8_t  node;
+static uint16_t last;
+
+// Keys pressed for the sequence, their releases are swallowed too
+static uint64_t swallowed;
+
+static bool leader_fire(void) {
+    uint8_t index = pgm_read_byte(&leader_action[node]);
+    active        = false;
+    if (!index) {
+        return false;
+    }
+
+    leader_action_t action;
+    memcpy_P(&action, &leader_actions[index - 1], sizeof(action));
+    if (action.text) {
+#ifdef SEND_SE_ENABLE
+        send_se_P(action.text);
+#else
+        send_string_P(action.text);
+#endif
+    }
+    for (uint8_t i = 0; i < action.count; i++) {
+        report_tap16(pgm_read_word(&leader_codes[action.first + i]), 0);
+    }
+    return true;
+}
+
+// Trie node after node for a key, 0 if no sequence continues with it
+static uint8_t leader_step(uint16_t keycode) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    if (keycode < KC_A || keycode > KC_0 || node >= LEADER_BRANCHES) {
+        return 0;
+    }
+    uint8_t symbol = pgm_read_byte(&leader_symbol[keycode - KC_A]);
+    if (symbol == LEADER_NONE) {
+        return 0;
+    }
+    return pgm_read_byte(&leader_next[node * LEADER_SYMBOLS + symbol]);
+}
+
+bool leader_process(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return true;
+    }
+
+    uint64_t bit = GEO_BIT(GEO_POS(record->event.key.row, record->event.key.col));
+    if (!record->event.pressed) {
+        if (swallowed & bit) {
+            swallowed &= ~bit;
+            return false;
+        }
+        return true;
+    }
+
+    if (keycode == LEAD) {
+        active = !active;
+        node   = 0;
+        last   = record->event.time;
+        swallowed |= bit;
+        return false;
+    }
+    if (!active) {
+        return true;
+    }
+
+    uint8_t next = leader_step(keycode);
+    if (!next) {
+        // A complete sequence lets the key through, a broken one eats it
+        if (leader_fire()) {
+            return true;
+        }
+        swallowed |= bit;
+        return false;
+    }
+
+    node = next;
+    last = record->event.time;
+    swallowed |= bit;
+#ifdef LEADER_FIRE_UNIQUE
+    if (node >= LEADER_BRANCHES) {
+        leader_fire();
+    }
+#endif
+    return false;
+}
+
+void leader_task(void) {
+    if (active && timer_elapsed(last) >= LEADER_TIMEOUT) {
+        leader_fire();
+    }
+}
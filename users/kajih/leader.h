@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Leader key sequences compiled into a trie by tools/leadergen.py from
+// leader/sequences.txt (see leader_trie.h). Each key after LEAD is one table
+// lookup for its column and one for the next node, so the cost per key does
+// not grow with the number of sequences. The sequence fires after
+// LEADER_TIMEOUT ms without a key, or at once on a key that does not continue
+// it, which is then typed as usual. A key that leaves the trie before any
+// sequence matched ends it silently, LEAD again cancels.
+//
+// LEADER_FIRE_UNIQUE fires a sequence as soon as it is typed when no longer
+// sequence starts with it, instead of waiting out the timeout.
+#ifndef LEADER_TIMEOUT
+#    define LEADER_TIMEOUT 1000
+#endif
+
+#define LEADER_NONE 0xFF
+
+// Text to send (UTF-8 in PROGMEM, NULL for none) and then count keycodes
+// from leader_codes[first]
+typedef struct {
+    const char *text;
+    uint8_t     first;
+    uint8_t     count;
+} leader_action_t;
+
+bool leader_process(uint16_t keycode, keyrecord_t *record);
+void leader_task(void);
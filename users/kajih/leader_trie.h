@@ -0,0 +1,137 @@
+#pragma once
+
+// Generated by tools/leadergen.py from leader/sequences.txt, do not edit.
+
+#define LEADER_SYMBOLS 23
+#define LEADER_NODES 59
+#define LEADER_BRANCHES 20 // nodes with children, the rest end a sequence
+
+// Key (KC_A .. KC_0) to trie column, LEADER_NONE if no sequence uses it
+static const uint8_t PROGMEM leader_symbol[36] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, LEADER_NONE, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, LEADER_NONE,
+    LEADER_NONE, 22, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE, LEADER_NONE,
+};
+
+// Next node per branch node and column, 0 where no sequence continues (the root
+// is never a child)
+// clang-format off
+static const uint8_t PROGMEM leader_next[LEADER_BRANCHES * LEADER_SYMBOLS] = {
+ //   a   b   c   d   e   f   g   h   i   k   l   m   n   o   p   q   r   s   t   u   v   w   z
+      1,  0,  2,  3,  4,  5,  6,  7,  0,  8,  9, 10, 11, 12, 13,  0, 14, 15, 16,  0,  0, 17,  0, // ""
+      0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0, 21, 22,  0,  0, 23,  0,  0,  0,  0,  0,  0, // "a"
+     24,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0, // "c"
+      0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0, // "d"
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0, 29,  0,  0,  0, // "e"
+     30,  0,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0, 32, 33,  0, 34, 35,  0,  0,  0,  0,  0, // "f"
+      0,  0,  0, 36, 37,  0,  0,  0, 38,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0, // "g"
+      0,  0,  0,  0,  0, 40,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "h"
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41,  0,  0,  0,  0, 42, // "k"
+      0,  0,  0,  0, 43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "l"
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0, // "m"
+      0,  0,  0,  0, 45,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "n"
+      0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0, // "o"
+      0,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "p"
+      0,  0,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "r"
+     18,  0, 51,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "s"
+      0,  0,  0, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  0, // "t"
+      0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 55,  0,  0,  0,  0, // "w"
+      0,  0,  0,  0, 56,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "sa"
+      0,  0,  0,  0, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, // "so"
+};
+// clang-format on
+
+// Action index + 1 per node, 0 for none
+static const uint8_t PROGMEM leader_action[LEADER_NODES] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+};
+
+static const char PROGMEM leader_text_0[] = "\xC3\xA4";
+static const char PROGMEM leader_text_1[] = "&&";
+static const char PROGMEM leader_text_2[] = "\xC3\xA5";
+static const char PROGMEM leader_text_3[] = "->";
+static const char PROGMEM leader_text_5[] = "\xC2\xA4";
+static const char PROGMEM leader_text_8[] = "==";
+static const char PROGMEM leader_text_9[] = "\xE2\x82\xAC";
+static const char PROGMEM leader_text_10[] = "=>";
+static const char PROGMEM leader_text_17[] = ">=";
+static const char PROGMEM leader_text_20[] = "\xC2\xBD";
+static const char PROGMEM leader_text_23[] = "<=";
+static const char PROGMEM leader_text_24[] = "Med v\xC3\xA4nliga h\xC3\xA4lsningar";
+static const char PROGMEM leader_text_25[] = "!=";
+static const char PROGMEM leader_text_26[] = "\xC3\xB6";
+static const char PROGMEM leader_text_27[] = "||";
+static const char PROGMEM leader_text_28[] = "\xC2\xA3";
+static const char PROGMEM leader_text_31[] = "\xC2\xA7";
+static const char PROGMEM leader_text_32[] = "// TODO: ";
+static const char PROGMEM leader_text_36[] = "\xC3\x84";
+static const char PROGMEM leader_text_37[] = "\xC3\x85";
+static const char PROGMEM leader_text_38[] = "\xC3\x96";
+
+static const uint16_t PROGMEM leader_codes[] = {
+    LCTL(KC_DOT),
+    KC_F9,
+    KC_F5,
+    LCTL(KC_F),
+    LCTL(KC_P),
+    LCTL(LSFT(KC_P)),
+    LCTL(KC_H),
+    LCTL(LSFT(KC_F)),
+    KC_F12,
+    LCTL(KC_F12),
+    LSFT(KC_F12),
+    LCTL(KC_K),
+    KC_S,
+    LCTL(KC_K),
+    KC_Z,
+    LSFT(LALT(KC_F)),
+    KC_F2,
+    LCTL(SE_ODIA),
+    LCTL(KC_W),
+    LCTL(LSFT(KC_T)),
+};
+
+static const leader_action_t PROGMEM leader_actions[] = {
+    {leader_text_0, 0, 0},
+    {leader_text_1, 0, 0},
+    {leader_text_2, 0, 0},
+    {leader_text_3, 0, 0},
+    {NULL, 0, 1},
+    {leader_text_5, 0, 0},
+    {NULL, 1, 1},
+    {NULL, 2, 1},
+    {leader_text_8, 0, 0},
+    {leader_text_9, 0, 0},
+    {leader_text_10, 0, 0},
+    {NULL, 3, 1},
+    {NULL, 4, 1},
+    {NULL, 5, 1},
+    {NULL, 6, 1},
+    {NULL, 7, 1},
+    {NULL, 8, 1},
+    {leader_text_17, 0, 0},
+    {NULL, 9, 1},
+    {NULL, 10, 1},
+    {leader_text_20, 0, 0},
+    {NULL, 11, 2},
+    {NULL, 13, 2},
+    {leader_text_23, 0, 0},
+    {leader_text_24, 0, 0},
+    {leader_text_25, 0, 0},
+    {leader_text_26, 0, 0},
+    {leader_text_27, 0, 0},
+    {leader_text_28, 0, 0},
+    {NULL, 15, 1},
+    {NULL, 16, 1},
+    {leader_text_31, 0, 0},
+    {leader_text_32, 0, 0},
+    {NULL, 17, 1},
+    {NULL, 18, 1},
+    {NULL, 19, 1},
+    {leader_text_36, 0, 0},
+    {leader_text_37, 0, 0},
+    {leader_text_38, 0, 0},
+};
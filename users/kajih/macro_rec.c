@@ -0,0 +1,263 @@
+#include "macro_rec.h"
+#include "kajih.h"
+
+#include <string.h>
+
+#define MACRO_MOD_FIRST 0xE0
+#define MACRO_MOD_LAST 0xE7
+
+static uint8_t  buffer[MACRO_REC_SIZE];
+static uint16_t length;
+
+// Recording: the report the host saw last and when the last event was stored
+static bool              recording;
+static report_keyboard_t last;
+static uint32_t          last_time;
+
+// Timed playback: next event and when the previous one was played
+static bool     playing;
+static uint16_t play_pos;
+static uint8_t  play_usage;
+static bool     play_pressed;
+static uint16_t play_delta;
+static uint32_t play_time;
+static uint8_t  saved_mods;
+static uint8_t  saved_weak;
+
+static host_driver_t  macro_driver;
+static host_driver_t *host;
+
+static void macro_put(uint8_t usage, bool pressed) {
+    uint32_t now   = timer_read32();
+    uint32_t delta = length ? now - last_time : 0;
+    uint32_t value = (delta < UINT16_MAX ? delta : UINT16_MAX) << 1 | pressed;
+    last_time      = now;
+
+    uint8_t bytes[3], count = 0;
+    do {
+        bytes[count] = value & 0x7F;
+        value >>= 7;
+        if (value) {
+            bytes[count] |= 0x80;
+        }
+        count++;
+    } while (value);
+
+    if (length + 1 + count > MACRO_REC_SIZE) {
+        recording = false;
+        return;
+    }
+    buffer[length++] = usage;
+    memcpy(&buffer[length], bytes, count);
+    length += count;
+}
+
+static bool has_key(const report_keyboard_t *report, uint8_t usage) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == usage) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Mods first, then releases, then presses, the order the host applies them in
+static void macro_diff(const report_keyboard_t *report) {
+    uint8_t changed = last.mods ^ report->mods;
+    for (uint8_t bit = 0; bit < 8 && recording; bit++) {
+        if (changed & (1 << bit)) {
+            macro_put(MACRO_MOD_FIRST + bit, report->mods & (1 << bit));
+        }
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS && recording; i++) {
+        if (last.keys[i] && !has_key(report, last.keys[i])) {
+            macro_put(last.keys[i], false);
+        }
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS && recording; i++) {
+        if (report->keys[i] && !has_key(&last, report->keys[i])) {
+            macro_put(report->keys[i], true);
+        }
+    }
+    last = *report;
+}
+
+static void macro_send_keyboard(report_keyboard_t *report) {
+    if (recording && !playing) {
+        macro_diff(report);
+    }
+    host->send_keyboard(report);
+}
+
+// Reads the event at pos and moves past it, returns its delta in ms
+static uint16_t macro_read(uint16_t *pos, uint8_t *usage, bool *pressed) {
+    uint32_t value = 0;
+    uint8_t  shift = 0, byte;
+    *usage         = buffer[(*pos)++];
+    do {
+        byte = buffer[(*pos)++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80 && *pos < length);
+    *pressed = value & 1;
+    return value >> 1;
+}
+
+static void macro_apply(uint8_t usage, bool pressed) {
+    if (usage >= MACRO_MOD_FIRST && usage <= MACRO_MOD_LAST) {
+        uint8_t bit = 1 << (usage - MACRO_MOD_FIRST);
+        if (pressed) {
+            add_weak_mods(bit);
+        } else {
+            del_weak_mods(bit);
+        }
+    } else if (pressed) {
+        add_key(usage);
+    } else {
+        del_key(usage);
+    }
+}
+
+static void macro_begin(void) {
+    saved_mods = get_mods();
+    saved_weak = get_weak_mods();
+    clear_mods();
+    clear_weak_mods();
+    playing = true;
+}
+
+// Whatever the macro left down is released and the held mods come back
+static void macro_end(void) {
+    clear_keys();
+    set_mods(saved_mods);
+    set_weak_mods(saved_weak);
+    send_keyboard_report();
+    playing = false;
+}
+
+static void macro_play_timed(void) {
+    if (!length) {
+        return;
+    }
+    macro_begin();
+    play_pos   = 0;
+    play_time  = timer_read32();
+    play_delta = macro_read(&play_pos, &play_usage, &play_pressed);
+}
+
+// Where the host will see a press among the others of its report: hosts
+// apply them in slot order, add_key() takes the first free slot. NKRO
+// reports are a bitmap read in usage order.
+static uint8_t press_order(uint8_t usage) {
+#ifdef NKRO_ENABLE
+    if (keymap_config.nkro) {
+        return usage;
+    }
+#endif
+    uint8_t slot = 0;
+    while (slot < KEYBOARD_REPORT_KEYS && keyboard_report->keys[slot]) {
+        slot++;
+    }
+    return slot;
+}
+
+// A report goes out when an event would touch a usage already changed since
+// the last report, would change a mod after a key press that has not been
+// sent yet, or would put a press ahead of an unsent one. Everything else can
+// share a report.
+static void macro_play_fast(void) {
+    uint8_t touched[32] = {0};
+    bool    pending = false, pressed_pending = false;
+    uint8_t last_press = 0;
+    uint8_t usage;
+    bool    pressed;
+
+    macro_begin();
+    for (uint16_t pos = 0; pos < length;) {
+        macro_read(&pos, &usage, &pressed);
+        bool    mod   = usage >= MACRO_MOD_FIRST && usage <= MACRO_MOD_LAST;
+        bool    press = !mod && pressed;
+        uint8_t order = press ? press_order(usage) : 0;
+        if ((touched[usage >> 3] & (1 << (usage & 7))) || (mod && pressed_pending) || (press && pressed_pending && order <= last_press)) {
+            send_keyboard_report();
+            memset(touched, 0, sizeof(touched));
+            pressed_pending = false;
+        }
+        macro_apply(usage, pressed);
+        touched[usage >> 3] |= 1 << (usage & 7);
+        pending = true;
+        if (press) {
+            pressed_pending = true;
+            last_press      = order;
+        }
+    }
+    if (pending) {
+        send_keyboard_report();
+    }
+    macro_end();
+}
+
+bool macro_rec_process(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return keycode < MREC || keycode > MFAST;
+    }
+    if (playing) {
+        macro_end();
+    }
+    switch (keycode) {
+        case MREC:
+            if (!recording && host) {
+                length    = 0;
+                last      = *keyboard_report;
+                recording = true;
+            } else {
+                recording = false;
+            }
+            return false;
+        case MPLAY:
+            if (!recording) {
+                macro_play_timed();
+            }
+            return false;
+        case MFAST:
+            if (!recording) {
+                macro_play_fast();
+            }
+            return false;
+    }
+    return true;
+}
+
+void macro_rec_task(void) {
+    // The USB driver is only set up after keyboard_post_init. Wrapped once,
+    // other wrappers (report_batch.c) may go on top of this one.
+    host_driver_t *driver = host_get_driver();
+    if (!host && driver) {
+        host         = driver;
+        macro_driver = *driver;
+        macro_driver.send_keyboard = macro_send_keyboard;
+        host_set_driver(&macro_driver);
+    }
+
+    if (!playing) {
+        return;
+    }
+    while (timer_elapsed32(play_time) >= play_delta) {
+        play_time += play_delta;
+        macro_apply(play_usage, play_pressed);
+        if (play_pos >= length) {
+            send_keyboard_report();
+            macro_end();
+            return;
+        }
+        play_delta = macro_read(&play_pos, &play_usage, &play_pressed);
+        // Events recorded from one report go out in one report again
+        if (play_delta) {
+            send_keyboard_report();
+        }
+    }
+}
+
+bool macro_rec_recording(void) {
+    return recording;
+}
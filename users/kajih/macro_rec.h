@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Dynamic macro recorder working on the keyboard reports sent to the host, so
+// tap dances, custom keys and send strings are captured as typed. Events are
+// stored as the HID usage (modifiers are 0xE0-0xE7) followed by a varint of the
+// ms since the previous event shifted left once, with the press flag in bit 0.
+// Most events fit in two bytes.
+//
+// MREC starts and stops recording, MPLAY replays with the recorded timing from
+// the housekeeping task (any key press stops it), MFAST replays at once with
+// the events packed into as few reports as keep the same result.
+#ifndef MACRO_REC_SIZE
+#    define MACRO_REC_SIZE 512
+#endif
+
+bool macro_rec_process(uint16_t keycode, keyrecord_t *record);
+void macro_rec_task(void);
+bool macro_rec_recording(void);
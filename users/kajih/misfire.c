@@ -0,0 +1,93 @@
+#include "misfire.h"
+
+#include <string.h>
+
+uint16_t misfire_counts[MISFIRE_RULES][GEO_KEYS];
+uint16_t misfire_totals[MISFIRE_RULES];
+
+// Hold-tap currently held as a hold, and whether another key went down under it
+static uint8_t hold_index = GEO_NONE;
+static bool    hold_used;
+
+// Key whose output is waiting to see if the next press corrects it
+static uint8_t  suspect = GEO_NONE;
+static uint8_t  suspect_rule;
+static uint16_t suspect_time;
+
+static bool is_backspace(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_MOD_TAP(keycode)) {
+        return record->tap.count && QK_MOD_TAP_GET_TAP_KEYCODE(keycode) == KC_BSPC;
+    }
+    if (IS_QK_LAYER_TAP(keycode)) {
+        return record->tap.count && QK_LAYER_TAP_GET_TAP_KEYCODE(keycode) == KC_BSPC;
+    }
+    if (IS_QK_MODS(keycode)) {
+        return QK_MODS_GET_BASIC_KEYCODE(keycode) == KC_BSPC;
+    }
+    return keycode == KC_BSPC;
+}
+
+static void misfire_count(uint8_t index, uint8_t rule) {
+    if (misfire_counts[rule][index] < UINT16_MAX) {
+        misfire_counts[rule][index]++;
+    }
+    if (misfire_totals[rule] < UINT16_MAX) {
+        misfire_totals[rule]++;
+    }
+}
+
+static void misfire_suspect(uint8_t index, uint8_t rule) {
+    suspect      = index;
+    suspect_rule = rule;
+    suspect_time = timer_read();
+}
+
+// Runs after the tapping code, so hold-taps arrive already resolved
+void misfire_post_process(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return;
+    }
+    uint8_t index = geo_index(GEO_POS(record->event.key.row, record->event.key.col));
+    if (index == GEO_NONE) {
+        return;
+    }
+
+    if (record->event.pressed) {
+        if (suspect != GEO_NONE) {
+            if (is_backspace(keycode, record) && timer_elapsed(suspect_time) < MISFIRE_WINDOW) {
+                misfire_count(suspect, suspect_rule);
+            }
+            suspect = GEO_NONE;
+        }
+        if (hold_index != GEO_NONE && index != hold_index) {
+            hold_used = true;
+        }
+        if ((IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) && !record->tap.count) {
+            hold_index = index;
+            hold_used  = false;
+        }
+        return;
+    }
+
+    if (index == hold_index) {
+        if (hold_used) {
+            misfire_suspect(index, MISFIRE_HOLD);
+        }
+        hold_index = GEO_NONE;
+    } else if (IS_QK_TAP_DANCE(keycode)) {
+        misfire_suspect(index, MISFIRE_TAP_DANCE);
+    }
+}
+
+void misfire_reset(void) {
+    memset(misfire_counts, 0, sizeof(misfire_counts));
+    memset(misfire_totals, 0, sizeof(misfire_totals));
+}
+
+// One 21 character OLED line with the totals per rule
+void misfire_render(void) {
+    oled_write_P(PSTR("Miss H:"), false);
+    oled_write(get_u16_str(misfire_totals[MISFIRE_HOLD], ' '), false);
+    oled_write_P(PSTR(" TD:"), false);
+    oled_write(get_u16_str(misfire_totals[MISFIRE_TAP_DANCE], ' '), false);
+}
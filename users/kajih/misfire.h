@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+#include "geometry.h"
+
+// Likely misfires, counted per key (LAYOUT index) and rule. A rule fires when
+// the key's output is corrected with Backspace as the very next press.
+#ifndef MISFIRE_WINDOW
+#    define MISFIRE_WINDOW 1000
+#endif
+
+enum misfire_rule {
+    MISFIRE_HOLD = 0,   // hold-tap held over another key, then Backspace
+    MISFIRE_TAP_DANCE,  // tap dance output, then Backspace
+    MISFIRE_RULES,
+};
+
+extern uint16_t misfire_counts[MISFIRE_RULES][GEO_KEYS];
+extern uint16_t misfire_totals[MISFIRE_RULES];
+
+void misfire_post_process(uint16_t keycode, keyrecord_t *record);
+void misfire_reset(void);
+void misfire_render(void);
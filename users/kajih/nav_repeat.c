@@ -0,0 +1,65 @@
+#include "nav_repeat.h"
+#include "kajih.h"
+
+#include <string.h>
+
+// Keys whose press was taken, their releases are too
+static uint64_t taken;
+
+// The repeating key
+static bool         active;
+static uint8_t      active_pos;
+static nav_repeat_t curve;
+static uint32_t     started;
+static uint16_t     next;
+
+bool nav_repeat_process(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return true;
+    }
+
+    uint8_t  pos = GEO_POS(record->event.key.row, record->event.key.col);
+    uint64_t bit = GEO_BIT(pos);
+    if (!record->event.pressed) {
+        if (!(taken & bit)) {
+            return true;
+        }
+        taken &= ~bit;
+        if (active && active_pos == pos) {
+            active = false;
+        }
+        return false;
+    }
+
+    for (uint8_t i = 0; i < nav_repeat_count; i++) {
+        if (pgm_read_word(&nav_repeats[i].keycode) == keycode) {
+            memcpy_P(&curve, &nav_repeats[i], sizeof(curve));
+            tap_code16(keycode);
+            taken |= bit;
+            active     = true;
+            active_pos = pos;
+            started    = timer_read32();
+            next       = (uint16_t)started + curve.delay;
+            return false;
+        }
+    }
+    return true;
+}
+
+void nav_repeat_task(void) {
+    if (!active) {
+        return;
+    }
+    uint16_t now = timer_read();
+    if (!timer_expired(now, next)) {
+        return;
+    }
+
+    tap_code16(curve.keycode);
+    uint32_t repeating = timer_elapsed32(started) - curve.delay;
+    uint8_t  interval  = curve.fastest;
+    if (repeating < curve.ramp) {
+        interval = curve.start - (curve.start - curve.fastest) * repeating / curve.ramp;
+    }
+    next = now + interval;
+}
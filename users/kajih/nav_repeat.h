@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Firmware key repeat for the keycodes listed in nav_repeats[]. The host
+// only ever sees taps, so its own repeat never starts: one tap on press,
+// another after delay ms, and from then on the interval shrinks linearly
+// from start to fastest ms over ramp ms of repeating. Held mods go along
+// with every tap. The last key pressed repeats, releasing it stops.
+
+typedef struct {
+    uint16_t keycode;
+    uint16_t delay;   // ms from the press to the first repeat
+    uint16_t ramp;    // ms of repeating until the fastest rate
+    uint8_t  start;   // ms between the first repeats
+    uint8_t  fastest; // ms between repeats after ramp
+} nav_repeat_t;
+
+// NAV_REPEAT(KC_DOWN, 180, 1500, 40, 8): first repeat after 180 ms, every
+// 40 ms at first and every 8 ms after 1.5 s
+#define NAV_REPEAT(kc, d, r, s, f) \
+    { .keycode = (kc), .delay = (d), .ramp = (r), .start = (s), .fastest = (f) }
+
+// Defined by the keymap
+extern const nav_repeat_t nav_repeats[];
+extern const uint8_t      nav_repeat_count;
+
+bool nav_repeat_process(uint16_t keycode, keyrecord_t *record);
+void nav_repeat_task(void);
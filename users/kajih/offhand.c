@@ -0,0 +1,125 @@
+#include "offhand.h"
+#include "hid_protocol.h"
+#include "scan_stats.h"
+
+#include "quantum.h"
+#include "transactions.h"
+#include "atomic_util.h"
+
+#include <string.h>
+
+// Triple buffered: the RPC handler edits a buffer that is neither the latest
+// one nor the one oled_task is reading, then makes it the latest. The reader
+// takes the latest and marks it as read, so no write ever lands in the buffer
+// being rendered, however the split thread and the main loop interleave. The
+// cursor travels with the text, commands edit a copy of the latest state.
+typedef struct {
+    char    text[OFFHAND_TEXT_SIZE + 1];
+    uint8_t cursor;
+} offhand_t;
+
+static offhand_t        offhand[3];
+static volatile uint8_t latest;
+static volatile uint8_t reading;
+static volatile bool    published;
+
+static offhand_t *offhand_back(void) {
+    uint8_t back;
+    ATOMIC_BLOCK_FORCEON {
+        back = latest == reading ? (latest + 1) % 3 : 3 - latest - reading;
+    }
+    // Nobody writes the latest buffer, reading it here is safe
+    memcpy(&offhand[back], &offhand[latest], sizeof(offhand_t));
+    return &offhand[back];
+}
+
+static void offhand_publish(offhand_t *state, bool redraw) {
+    ATOMIC_BLOCK_FORCEON {
+        latest = state - offhand;
+        published |= redraw;
+    }
+}
+
+static void offhand_clear(offhand_t *state) {
+    memset(state->text, ' ', OFFHAND_TEXT_SIZE);
+    state->text[OFFHAND_TEXT_SIZE] = '\0';
+    state->cursor                  = 0;
+}
+
+static void offhand_write(offhand_t *state, const uint8_t *data, uint8_t length) {
+    for (uint8_t i = 0; i < length && state->cursor < OFFHAND_TEXT_SIZE; i++) {
+        if (data[i] == '\n') {
+            state->cursor += OFFHAND_COLS - state->cursor % OFFHAND_COLS;
+        } else {
+            state->text[state->cursor++] = data[i];
+        }
+    }
+}
+
+// Runs on the off-hand, the message is [opcode][args...] as forwarded by offhand_send
+static void offhand_rpc(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *msg = in_data;
+    offhand_t     *state;
+    if (in_buflen < 1 || in_buflen > RPC_M2S_BUFFER_SIZE) {
+        return;
+    }
+
+    switch (msg[0]) {
+        case HID_OP_TEXT_WRITE:
+            if (in_buflen >= 2 && msg[1] <= in_buflen - 2) {
+                state = offhand_back();
+                offhand_write(state, &msg[2], msg[1]);
+                offhand_publish(state, true);
+            }
+            break;
+        case HID_OP_TEXT_CLEAR:
+            state = offhand_back();
+            offhand_clear(state);
+            offhand_publish(state, true);
+            break;
+        case HID_OP_CURSOR_SET:
+            if (in_buflen >= 3 && msg[1] < OFFHAND_COLS && msg[2] < OFFHAND_ROWS) {
+                state         = offhand_back();
+                state->cursor = msg[2] * OFFHAND_COLS + msg[1];
+                offhand_publish(state, false);
+            }
+            break;
+    }
+}
+
+void offhand_init(void) {
+    offhand_clear(&offhand[0]);
+    latest    = 0;
+    reading   = 0;
+    published = true;
+    transaction_register_rpc(RPC_ID_USER_HID_SYNC, offhand_rpc);
+}
+
+// The text stays in the OLED buffer, so it is only laid out again after a publish
+void offhand_render(void) {
+    bool    redraw;
+    uint8_t index;
+    ATOMIC_BLOCK_FORCEON {
+        redraw    = published;
+        published = false;
+        index     = latest;
+        reading   = index;
+    }
+    if (redraw) {
+        oled_write(offhand[index].text, false);
+    }
+}
+
+bool offhand_send(uint8_t opcode, const uint8_t *args, uint8_t length) {
+    uint8_t msg[RPC_M2S_BUFFER_SIZE];
+    if (length > sizeof(msg) - 1) {
+        return false;
+    }
+
+    msg[0] = opcode;
+    memcpy(&msg[1], args, length);
+
+    bool ok = transaction_rpc_send(RPC_ID_USER_HID_SYNC, length + 1, msg);
+    scan_stats_split_result(ok);
+    return ok;
+}
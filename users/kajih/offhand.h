@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Text area below the logo on the off-hand OLED, in characters
+#ifndef OFFHAND_COLS
+#    define OFFHAND_COLS 21
+#endif
+#ifndef OFFHAND_ROWS
+#    define OFFHAND_ROWS 5
+#endif
+#define OFFHAND_TEXT_SIZE (OFFHAND_COLS * OFFHAND_ROWS)
+
+// Longest text run that fits in one request and one split transaction
+#define OFFHAND_WRITE_MAX 29
+
+void offhand_init(void);
+void offhand_render(void);
+bool offhand_send(uint8_t opcode, const uint8_t *args, uint8_t length);
@@ -0,0 +1,32 @@
+#include "oled_art.h"
+#include "oled_art_kajih.h"
+
+#include "quantum.h"
+
+_Static_assert(sizeof(art_logo) == ART_LOGO_PAGES * OLED_DISPLAY_WIDTH, "logo must be whole OLED pages");
+
+oled_art_t oled_art_logo = {art_logo, 0, sizeof(art_logo), false};
+
+void oled_art_draw(oled_art_t *art) {
+    if (art->drawn) {
+        return;
+    }
+    if (art->offset == 0) {
+        oled_write_raw_P(art->data, art->size);
+    } else {
+        for (uint16_t i = 0; i < art->size; i++) {
+            oled_write_raw_byte(pgm_read_byte(&art->data[i]), art->offset + i);
+        }
+    }
+    art->drawn = true;
+}
+
+void oled_art_invalidate(oled_art_t *art) {
+    art->drawn = false;
+}
+
+void render_logo(void) {
+    oled_art_draw(&oled_art_logo);
+    // Text rendered after the logo starts below it, as it did when the logo was glyphs
+    oled_set_cursor(0, ART_LOGO_PAGES);
+}
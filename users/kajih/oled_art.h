@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Pre-rendered artwork, raw OLED buffer bytes written in one copy. The driver
+// keeps its buffer between frames, so artwork is only written again after
+// oled_art_invalidate.
+typedef struct {
+    const char *data;
+    uint16_t    offset;
+    uint16_t    size;
+    bool        drawn;
+} oled_art_t;
+
+extern oled_art_t oled_art_logo;
+
+void oled_art_draw(oled_art_t *art);
+void oled_art_invalidate(oled_art_t *art);
+
+void render_logo(void);
@@ -0,0 +1,35 @@
+// Generated by tools/fontgen.py from font/glcdfont_kajih.bdf, do not edit.
+// Raw OLED pages, 128 bytes per page, bit 0 is the top pixel row.
+#pragma once
+
+#include "progmem.h"
+
+#define ART_LOGO_PAGES 3
+
+static const char PROGMEM art_logo[] = {
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xFC, 0xFC, 0xFC, 0xF8, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFC, 0xFC, 0xFE, 0xFE, 0xFC,
+    0xFC, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x40, 0xC0,
+    0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x3B, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0x80, 0x81, 0x01, 0x81, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x81, 0x83, 0x83, 0x01,
+    0x81, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0x20, 0x60, 0x3D, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x7F, 0x1C, 0x1E, 0x17, 0x33, 0x30, 0x20, 0x20, 0x3C, 0x3E, 0x20, 0xB0, 0xF8, 0x3E, 0x02,
+    0x00, 0x7E, 0x1E, 0x06, 0x06, 0x02, 0x02, 0x7E, 0x7E, 0x40, 0x60, 0x30, 0x78, 0x5C, 0x66, 0x3E,
+    0x7E, 0x40, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x7F, 0x63, 0x41, 0x70, 0x70, 0xF0, 0x98,
+    0x0F, 0x03, 0x70, 0x7E, 0x0F, 0x03, 0x0F, 0x0C, 0x06, 0x03, 0x71, 0x7F, 0x03, 0x00, 0x00, 0x7F,
+    0x5C, 0x1C, 0x1E, 0x33, 0x31, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x0F, 0x07, 0x0F, 0x1B, 0x3E, 0x3F, 0x1F, 0x2F, 0x7D,
+    0x7F, 0x38, 0x1F, 0x3F, 0x67, 0x7C, 0x7C, 0x0F, 0x3F, 0x70, 0x7E, 0x79, 0x07, 0x1F, 0x0F, 0x1C,
+    0x1F, 0x1E, 0x09, 0x03, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
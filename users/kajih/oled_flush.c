@@ -0,0 +1,29 @@
+#include "oled_flush.h"
+#include "timer_us.h"
+
+#include "quantum.h"
+
+uint16_t oled_flush_stall_max_us;
+
+static uint32_t block_us = OLED_FLUSH_BLOCK_US;
+
+// Only the render calls count, whatever else ran in the loop is not OLED time
+void oled_flush_task(void) {
+    uint32_t stall = 0;
+
+    while (stall + block_us <= OLED_FLUSH_BUDGET_US) {
+        uint32_t start = timer_us_read();
+        oled_render_dirty(false);
+        uint32_t took = timer_us_elapsed(start);
+        stall += took;
+        if (took < OLED_FLUSH_IDLE_US) {
+            break;
+        }
+        // Follow increases at once, decreases slowly, so the budget is not overrun
+        block_us = took > block_us ? took : block_us - (block_us - took) / 8;
+    }
+
+    if (stall > oled_flush_stall_max_us) {
+        oled_flush_stall_max_us = stall > UINT16_MAX ? UINT16_MAX : stall;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+// Time budget per main loop for flushing dirty OLED blocks, in microseconds.
+// The driver itself sends one block per loop, further blocks are only sent
+// while the time spent in them plus the estimate for one more still fits in
+// the budget. The driver's own block is not timed and comes on top.
+#ifndef OLED_FLUSH_BUDGET_US
+#    define OLED_FLUSH_BUDGET_US 1500
+#endif
+// Starting estimate for one block, refined from measurements
+#ifndef OLED_FLUSH_BLOCK_US
+#    define OLED_FLUSH_BLOCK_US 800
+#endif
+// A render call faster than this found nothing dirty
+#ifndef OLED_FLUSH_IDLE_US
+#    define OLED_FLUSH_IDLE_US 30
+#endif
+
+// Longest time spent flushing extra blocks in one loop
+extern uint16_t oled_flush_stall_max_us;
+
+void oled_flush_task(void);
@@ -0,0 +1,116 @@
+#include "one_shot.h"
+#include "kajih.h"
+
+// One bit per mod (report order) or per layer
+typedef struct {
+    uint32_t down;   // trigger held, nothing else released yet
+    uint32_t used;   // trigger held and another key went by
+    uint32_t queued; // trigger tapped, waits for the next key
+} one_shot_t;
+
+static one_shot_t mods;
+static one_shot_t layers;
+
+static void one_shot_set(one_shot_t *state, uint32_t bits, bool on) {
+    if (state == &mods) {
+        if (on) {
+            register_mods(bits);
+        } else {
+            unregister_mods(bits);
+        }
+    } else if (on) {
+        layer_or(bits);
+    } else {
+        layer_and(~bits);
+    }
+}
+
+static void one_shot_press(one_shot_t *state, uint32_t bits) {
+    uint32_t off = bits & ~(state->down | state->used | state->queued);
+    if (off) {
+        one_shot_set(state, off, true);
+    }
+    state->down |= bits;
+    state->used &= ~bits;
+    state->queued &= ~bits;
+}
+
+static void one_shot_release(one_shot_t *state, uint32_t bits) {
+    uint32_t used = bits & state->used;
+    state->queued |= bits & state->down;
+    state->down &= ~bits;
+    state->used &= ~bits;
+    if (used) {
+        one_shot_set(state, used, false);
+    }
+}
+
+// Another key was released: held triggers count as used, tapped ones end
+static void one_shot_consume(one_shot_t *state) {
+    state->used |= state->down;
+    state->down = 0;
+    if (state->queued) {
+        one_shot_set(state, state->queued, false);
+        state->queued = 0;
+    }
+}
+
+static void one_shot_clear(one_shot_t *state) {
+    uint32_t on = state->down | state->used | state->queued;
+    if (on) {
+        one_shot_set(state, on, false);
+    }
+    *state = (one_shot_t){0};
+}
+
+void one_shot_cancel(void) {
+    one_shot_clear(&mods);
+    one_shot_clear(&layers);
+}
+
+// Keys that only change mods or layers themselves
+static bool one_shot_ignored(uint16_t keycode, keyrecord_t *record) {
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        return !record->tap.count;
+    }
+    return IS_MODIFIER_KEYCODE(keycode) || IS_QK_MOMENTARY(keycode) || IS_QK_LAYER_MOD(keycode) || IS_QK_LAYER_TAP_TOGGLE(keycode);
+}
+
+// Runs after the tapping engine, so hold-taps are resolved by now and the
+// triggers come with the keycode of the layer they were pressed on
+bool one_shot_process(uint16_t keycode, keyrecord_t *record) {
+    bool pressed = record->event.pressed;
+
+    if (keycode >= ONE_SHOT_MOD && keycode <= ONE_SHOT_MOD_MAX) {
+        // 5 bit keycode mods to report mods
+        uint8_t bits = keycode - ONE_SHOT_MOD;
+        bits         = bits & 0x10 ? (bits & 0x0F) << 4 : bits;
+        if (pressed) {
+            one_shot_press(&mods, bits);
+        } else {
+            one_shot_release(&mods, bits);
+        }
+        return false;
+    }
+    if (keycode >= ONE_SHOT_LAYER && keycode <= ONE_SHOT_LAYER_MAX) {
+        uint32_t bits = (uint32_t)1 << (keycode - ONE_SHOT_LAYER);
+        if (pressed) {
+            one_shot_press(&layers, bits);
+        } else {
+            one_shot_release(&layers, bits);
+        }
+        return false;
+    }
+    if (keycode == OSCNCL) {
+        if (pressed) {
+            one_shot_cancel();
+        }
+        return false;
+    }
+
+    if (!pressed && !one_shot_ignored(keycode, record)) {
+        one_shot_consume(&mods);
+        one_shot_consume(&layers);
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Timerless one-shot mods and layers in the style of Callum's oneshot.c. A
+// tapped trigger stays on until the next other key is released, a held one
+// works as a plain mod or MO() and goes off with its release once another
+// key was used. Triggers stack, so Ctrl and Shift tapped in turn both apply
+// to the next key. Layer and mod keys, including hold-taps held, do not use
+// them up. OSCNCL drops everything that is on.
+//
+// The triggers are userspace keycodes rather than OSM()/OSL(). They are not
+// tap keys, so the tapping engine never holds the next key back for them, and
+// one_shot_process() sees them from process_record_user with hold-taps and
+// the layer of the press already resolved, press and release alike.
+
+// Trigger for 5 bit mods, OSMOD(MOD_LSFT), and for a layer
+#define OSMOD(mod) (ONE_SHOT_MOD + ((mod)&0x1F))
+#define OSLAYER(layer) (ONE_SHOT_LAYER + ((layer)&0x1F))
+
+#define OSM_LCTL OSMOD(MOD_LCTL)
+#define OSM_LSFT OSMOD(MOD_LSFT)
+#define OSM_LALT OSMOD(MOD_LALT)
+#define OSM_LGUI OSMOD(MOD_LGUI)
+#define OSM_RCTL OSMOD(MOD_RCTL)
+#define OSM_RSFT OSMOD(MOD_RSFT)
+#define OSM_RALT OSMOD(MOD_RALT)
+#define OSM_RGUI OSMOD(MOD_RGUI)
+
+bool one_shot_process(uint16_t keycode, keyrecord_t *record);
+void one_shot_cancel(void);
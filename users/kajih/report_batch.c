@@ -0,0 +1,126 @@
+#include "report_batch.h"
+
+#include <string.h>
+
+report_batch_stats_t report_batch_stats;
+
+static host_driver_t  batch_driver;
+static host_driver_t *host;
+
+// The report the host saw last and the one waiting to replace it
+static report_keyboard_t sent;
+static report_keyboard_t pending;
+static bool              waiting;
+
+// What pending changed relative to sent
+static uint8_t touched[32];
+static uint8_t touched_mods;
+static uint8_t last_press;
+static bool    pressed;
+
+static bool has_key(const report_keyboard_t *report, uint8_t usage) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == usage) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_touched(uint8_t usage) {
+    return touched[usage >> 3] & (1 << (usage & 7));
+}
+
+static void batch_flush(void) {
+    if (!waiting) {
+        return;
+    }
+    host->send_keyboard(&pending);
+    report_batch_stats.sent++;
+    sent    = pending;
+    waiting = false;
+    memset(touched, 0, sizeof(touched));
+    touched_mods = 0;
+    pressed      = false;
+}
+
+// Same rule as the macro recorder's fast playback, plus slot order: hosts
+// apply the presses of one report in slot order
+static bool batch_conflict(const report_keyboard_t *report) {
+    uint8_t mods = pending.mods ^ report->mods;
+    if ((mods & touched_mods) || (mods && pressed)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t usage = report->keys[i];
+        if (usage && !has_key(&pending, usage) && (is_touched(usage) || (pressed && i <= last_press))) {
+            return true;
+        }
+        usage = pending.keys[i];
+        if (usage && !has_key(report, usage) && is_touched(usage)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void batch_send_keyboard(report_keyboard_t *report) {
+    report_batch_stats.submitted++;
+    if (!waiting) {
+        pending = sent;
+    } else if (batch_conflict(report)) {
+        batch_flush();
+    }
+
+    touched_mods |= pending.mods ^ report->mods;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t usage = report->keys[i];
+        if (usage && !has_key(&pending, usage)) {
+            touched[usage >> 3] |= 1 << (usage & 7);
+            last_press = i;
+            pressed    = true;
+            report_batch_stats.presses++;
+        }
+        usage = pending.keys[i];
+        if (usage && !has_key(report, usage)) {
+            touched[usage >> 3] |= 1 << (usage & 7);
+        }
+    }
+    pending = *report;
+    waiting = true;
+}
+
+static void batch_send_nkro(report_nkro_t *report) {
+    batch_flush();
+    host->send_nkro(report);
+}
+
+static void batch_send_mouse(report_mouse_t *report) {
+    batch_flush();
+    host->send_mouse(report);
+}
+
+static void batch_send_extra(report_extra_t *report) {
+    batch_flush();
+    host->send_extra(report);
+}
+
+void report_batch_task(void) {
+    // The USB driver is only set up after keyboard_post_init, wrapped once
+    // like the macro recorder does so the two stack instead of swapping
+    host_driver_t *driver = host_get_driver();
+    if (!host && driver) {
+        host                       = driver;
+        batch_driver               = *driver;
+        batch_driver.send_keyboard = batch_send_keyboard;
+        batch_driver.send_nkro     = batch_send_nkro;
+        batch_driver.send_mouse    = batch_send_mouse;
+        batch_driver.send_extra    = batch_send_extra;
+        host_set_driver(&batch_driver);
+    }
+    batch_flush();
+}
+
+void report_batch_reset(void) {
+    memset(&report_batch_stats, 0, sizeof(report_batch_stats));
+}
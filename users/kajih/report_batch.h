@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Keyboard reports sent while one scan's events are processed are merged and
+// go out as one report from the housekeeping task. A report is sent early
+// when the next one would change a usage or mod already changed since the
+// last report sent, would change mods after an unsent key press, or would put
+// a new press in a slot before an unsent one. Everything else reaches the
+// host with the same result as the separate reports.
+//
+// The wrapper sits around the host driver like the macro recorder's, NKRO,
+// mouse and extra reports flush the pending keyboard report before they pass.
+typedef struct {
+    uint32_t submitted; // keyboard reports QMK sent
+    uint32_t sent;      // reports that reached the host
+    uint32_t presses;   // new non-mod usages, the keystrokes
+} report_batch_stats_t;
+
+extern report_batch_stats_t report_batch_stats;
+
+void report_batch_task(void);
+void report_batch_reset(void);
@@ -0,0 +1,40 @@
+#include "report_tap.h"
+
+uint8_t report_mods(uint16_t code) {
+    if (!IS_QK_MODS(code)) {
+        return 0;
+    }
+    uint8_t mods = QK_MODS_GET_MODS(code);
+    return mods & 0x10 ? (mods & 0x0F) << 4 : mods;
+}
+
+// tap_code16() between del_mods() and set_mods() sends the weak mods, the
+// key, the key release and the mod release as separate reports, and the held
+// mods only come back with whatever is sent next. Here the report state is
+// set up first and sent once per edge.
+void report_tap16(uint16_t code, uint8_t drop) {
+    uint8_t mods = get_mods();
+    uint8_t weak = get_weak_mods();
+    uint8_t key  = QK_MODS_GET_BASIC_KEYCODE(code);
+
+    del_mods(drop);
+    add_weak_mods(report_mods(code));
+    add_key(key);
+    send_keyboard_report();
+#if TAP_CODE_DELAY > 0
+    wait_ms(TAP_CODE_DELAY);
+#endif
+
+    del_key(key);
+    set_mods(mods);
+    set_weak_mods(weak);
+    send_keyboard_report();
+}
+
+bool shift_and_tap16(keyrecord_t *record, uint16_t scode, uint16_t code) {
+    if (!record->event.pressed) {
+        return true;
+    }
+    report_tap16(get_mods() & MOD_MASK_SHIFT ? scode : code, MOD_MASK_SHIFT);
+    return false;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// 8 bit report mods of a QK_MODS keycode, 0 for a plain one
+uint8_t report_mods(uint16_t code);
+
+// Taps a keycode, with its own mods (SE_ symbols on AltGr), in two keyboard
+// reports: one with the final mods and the key, one putting the held mods
+// back. The mods in drop are left out of the first report only.
+void report_tap16(uint16_t code, uint8_t drop);
+
+// Custom key that sends scode with Shift held and code without. Shift is not
+// sent along with either. Returns false on press, meant to be returned from
+// process_record_user.
+bool shift_and_tap16(keyrecord_t *record, uint16_t scode, uint16_t code);
@@ -1,4 +1,126 @@
-SRC += kajih.c
+SRC += kajih.c geometry.c report_tap.c
+
+# Regenerate the OLED font from font/glcdfont_kajih.bdf, needs python3 on the build host
+ifeq ($(strip $(FONTGEN)), yes)
+	FONTGEN_OUTPUT := $(shell python3 $(USER_PATH)/tools/fontgen.py)
+	$(info $(FONTGEN_OUTPUT))
+endif
+
+# Regenerate leader_trie.h from leader/sequences.txt, needs python3 on the build host
+ifeq ($(strip $(LEADERGEN)), yes)
+	LEADERGEN_OUTPUT := $(shell python3 $(USER_PATH)/tools/leadergen.py)
+	$(info $(LEADERGEN_OUTPUT))
+endif
+
+# Regenerate typo_trie.h from typo/typos.txt, needs python3 on the build host
+ifeq ($(strip $(TYPOGEN)), yes)
+	TYPOGEN_OUTPUT := $(shell python3 $(USER_PATH)/tools/typogen.py)
+	$(info $(TYPOGEN_OUTPUT))
+endif
+
+# Logo and other static artwork, blitted as raw OLED pages
+ifeq ($(strip $(OLED_ENABLE)), yes)
+	SRC += oled_art.c
+	OPT_DEFS += -DOLED_ART_ENABLE
+endif
+
+# Combos matched on matrix positions, chords[] comes from the keymap
+ifeq ($(strip $(CHORD_ENABLE)), yes)
+	SRC += chord.c
+	OPT_DEFS += -DCHORD_ENABLE
+endif
+
+# String output with a precomputed Swedish host layout table
+ifeq ($(strip $(SEND_SE_ENABLE)), yes)
+	SRC += send_se.c
+	OPT_DEFS += -DSEND_SE_ENABLE
+endif
+
+# Records the keyboard reports sent to the host and plays them back
+ifeq ($(strip $(MACRO_REC_ENABLE)), yes)
+	SRC += macro_rec.c
+	OPT_DEFS += -DMACRO_REC_ENABLE
+endif
+
+# Leader key sequences from leader/sequences.txt, text needs SEND_SE_ENABLE for
+# anything beyond ASCII
+ifeq ($(strip $(LEADER_TRIE_ENABLE)), yes)
+	SRC += leader.c
+	OPT_DEFS += -DLEADER_TRIE_ENABLE
+endif
+
+# Typo correction from typo/typos.txt, corrections beyond ASCII need
+# SEND_SE_ENABLE
+ifeq ($(strip $(TYPO_FIX_ENABLE)), yes)
+	SRC += typo.c
+	OPT_DEFS += -DTYPO_FIX_ENABLE
+endif
+
+# Alternate repeat key completions, QMK's REPEAT_KEY_ENABLE brings QK_REP/QK_AREP
+ifeq ($(strip $(REPEAT_KEY_ENABLE)), yes)
+	SRC += alt_repeat.c
+endif
+
+# Timerless one-shot mods and layers on the OSMOD() and OSLAYER() keycodes
+ifeq ($(strip $(ONE_SHOT_ENABLE)), yes)
+	SRC += one_shot.c
+	OPT_DEFS += -DONE_SHOT_ENABLE
+endif
+
+# Game profile: plain keycodes sent at once, no hold-taps, tap dances or chords
+ifeq ($(strip $(GAME_MODE_ENABLE)), yes)
+	SRC += game.c
+	OPT_DEFS += -DGAME_MODE_ENABLE
+endif
+
+# Firmware repeat with acceleration for the keycodes in nav_repeats[]
+ifeq ($(strip $(NAV_REPEAT_ENABLE)), yes)
+	SRC += nav_repeat.c
+	OPT_DEFS += -DNAV_REPEAT_ENABLE
+endif
+
+# One keyboard report per scan where the event order allows it
+ifeq ($(strip $(REPORT_BATCH_ENABLE)), yes)
+	SRC += report_batch.c
+	OPT_DEFS += -DREPORT_BATCH_ENABLE
+endif
+
+# Per key and per layer press counters, saved to the EEPROM user datablock
+ifeq ($(strip $(USAGE_STATS_ENABLE)), yes)
+	SRC += usage.c
+	OPT_DEFS += -DUSAGE_STATS_ENABLE
+endif
+
+# Press duration histograms for mod-tap and layer-tap keys
+ifeq ($(strip $(HOLDTAP_STATS_ENABLE)), yes)
+	SRC += holdtap_stats.c
+	OPT_DEFS += -DHOLDTAP_STATS_ENABLE
+endif
+
+# Home-row mods pressed mid-word resolve as taps at once, needs FLOW_TAP_TERM
+ifeq ($(strip $(FLOW_TAP_ENABLE)), yes)
+	SRC += flow_tap.c
+	OPT_DEFS += -DFLOW_TAP_ENABLE
+endif
+
+# Counts Backspace right after a hold-tap hold or a tap dance, per key
+ifeq ($(strip $(MISFIRE_STATS_ENABLE)), yes)
+	SRC += misfire.c
+	OPT_DEFS += -DMISFIRE_STATS_ENABLE
+endif
+
+# Time budgeted OLED flushing, needs OLED_ENABLE
+ifeq ($(strip $(OLED_FLUSH_ENABLE)), yes)
+	SRC += oled_flush.c
+	OPT_DEFS += -DOLED_FLUSH_ENABLE
+endif
+
+# Versioned raw HID command protocol, drives the off-hand OLED text
+ifeq ($(strip $(HID_PROTOCOL_ENABLE)), yes)
+	RAW_ENABLE = yes
+	SRC += hid_protocol.c offhand.c scan_stats.c
+	OPT_DEFS += -DHID_PROTOCOL_ENABLE
+endif
 
 # ifeq ($(strip $(RGBLIGHT_ENABLE)), yes)
 # 	# Include my fancy rgb functions source here
@@ -0,0 +1,59 @@
+#include "scan_stats.h"
+#include "timer_us.h"
+#include "timer.h"
+
+#include <string.h>
+
+scan_stats_t scan_stats;
+
+static uint32_t last_loop_us;
+static uint32_t rate_window_ms;
+static uint32_t rate_window_scans;
+
+static inline void saturating_inc(uint16_t *counter) {
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+}
+
+void scan_stats_task(void) {
+    // First call after boot or reset only starts the clock
+    if (scan_stats.scans++ == 0) {
+        rate_window_ms = timer_read32();
+        last_loop_us   = timer_us_read();
+        return;
+    }
+
+    rate_window_scans++;
+    if (timer_elapsed32(rate_window_ms) >= 1000) {
+        scan_stats.scan_rate = rate_window_scans;
+        rate_window_scans    = 0;
+        rate_window_ms       = timer_read32();
+    }
+
+#ifndef TIMER_US_COARSE
+    uint32_t now     = timer_us_read();
+    uint32_t elapsed = now - last_loop_us;
+    last_loop_us     = now;
+
+    uint8_t  bucket = 0;
+    uint32_t scaled = elapsed >> SCAN_STATS_BUCKET_SHIFT;
+    while (scaled && bucket < SCAN_STATS_BUCKETS - 1) {
+        scaled >>= 1;
+        bucket++;
+    }
+    saturating_inc(&scan_stats.latency[bucket]);
+    if (elapsed > scan_stats.latency_max_us) {
+        scan_stats.latency_max_us = elapsed > UINT16_MAX ? UINT16_MAX : elapsed;
+    }
+#endif
+}
+
+void scan_stats_split_result(bool ok) {
+    saturating_inc(ok ? &scan_stats.split_ok : &scan_stats.split_fail);
+}
+
+void scan_stats_reset(void) {
+    memset(&scan_stats, 0, sizeof(scan_stats));
+    rate_window_scans = 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Loop time histogram, bucket 0 is < 64us and every following bucket doubles.
+// Left empty without a us timer (TIMER_US_COARSE), STATS_GET flags that.
+#define SCAN_STATS_BUCKETS 8
+#define SCAN_STATS_BUCKET_SHIFT 6
+
+typedef struct {
+    uint32_t scan_rate;
+    uint32_t scans;
+    uint16_t latency[SCAN_STATS_BUCKETS];
+    uint16_t latency_max_us;
+    uint16_t split_ok;
+    uint16_t split_fail;
+} scan_stats_t;
+
+extern scan_stats_t scan_stats;
+
+void scan_stats_task(void);
+void scan_stats_split_result(bool ok);
+void scan_stats_reset(void);
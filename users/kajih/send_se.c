@@ -0,0 +1,157 @@
+#include "send_se.h"
+
+#include "keymap_swedish.h"
+
+// Keycode with Shift/AltGr for every typeable ASCII character, 0 for the rest
+// clang-format off
+static const uint16_t PROGMEM se_ascii[128] = {
+    ['\t'] = KC_TAB,   ['\n'] = KC_ENT,   [' '] = KC_SPC,    ['!'] = SE_EXLM,
+    ['"'] = SE_DQUO,   ['#'] = SE_HASH,   ['$'] = SE_DLR,    ['%'] = SE_PERC,
+    ['&'] = SE_AMPR,   ['\''] = SE_QUOT,  ['('] = SE_LPRN,   [')'] = SE_RPRN,
+    ['*'] = SE_ASTR,   ['+'] = SE_PLUS,   [','] = SE_COMM,   ['-'] = SE_MINS,
+    ['.'] = SE_DOT,    ['/'] = SE_SLSH,   ['0'] = SE_0,      ['1'] = SE_1,
+    ['2'] = SE_2,      ['3'] = SE_3,      ['4'] = SE_4,      ['5'] = SE_5,
+    ['6'] = SE_6,      ['7'] = SE_7,      ['8'] = SE_8,      ['9'] = SE_9,
+    [':'] = SE_COLN,   [';'] = SE_SCLN,   ['<'] = SE_LABK,   ['='] = SE_EQL,
+    ['>'] = SE_RABK,   ['?'] = SE_QUES,   ['@'] = SE_AT,     ['A'] = S(KC_A),
+    ['B'] = S(KC_B),   ['C'] = S(KC_C),   ['D'] = S(KC_D),   ['E'] = S(KC_E),
+    ['F'] = S(KC_F),   ['G'] = S(KC_G),   ['H'] = S(KC_H),   ['I'] = S(KC_I),
+    ['J'] = S(KC_J),   ['K'] = S(KC_K),   ['L'] = S(KC_L),   ['M'] = S(KC_M),
+    ['N'] = S(KC_N),   ['O'] = S(KC_O),   ['P'] = S(KC_P),   ['Q'] = S(KC_Q),
+    ['R'] = S(KC_R),   ['S'] = S(KC_S),   ['T'] = S(KC_T),   ['U'] = S(KC_U),
+    ['V'] = S(KC_V),   ['W'] = S(KC_W),   ['X'] = S(KC_X),   ['Y'] = S(KC_Y),
+    ['Z'] = S(KC_Z),   ['['] = SE_LBRC,   ['\\'] = SE_BSLS,  [']'] = SE_RBRC,
+    ['^'] = SE_CIRC,   ['_'] = SE_UNDS,   ['`'] = SE_GRV,    ['a'] = KC_A,
+    ['b'] = KC_B,      ['c'] = KC_C,      ['d'] = KC_D,      ['e'] = KC_E,
+    ['f'] = KC_F,      ['g'] = KC_G,      ['h'] = KC_H,      ['i'] = KC_I,
+    ['j'] = KC_J,      ['k'] = KC_K,      ['l'] = KC_L,      ['m'] = KC_M,
+    ['n'] = KC_N,      ['o'] = KC_O,      ['p'] = KC_P,      ['q'] = KC_Q,
+    ['r'] = KC_R,      ['s'] = KC_S,      ['t'] = KC_T,      ['u'] = KC_U,
+    ['v'] = KC_V,      ['w'] = KC_W,      ['x'] = KC_X,      ['y'] = KC_Y,
+    ['z'] = KC_Z,      ['{'] = SE_LCBR,   ['|'] = SE_PIPE,   ['}'] = SE_RCBR,
+    ['~'] = SE_TILD,
+};
+// clang-format on
+
+// The Swedish characters outside ASCII, by code point
+static const struct {
+    uint16_t cp;
+    uint16_t code;
+} PROGMEM se_extra[] = {
+    {0x00A3, SE_PND},  {0x00A4, SE_CURR}, {0x00A7, SE_SECT}, {0x00BD, SE_HALF},
+    {0x00C4, S(SE_ADIA)}, {0x00C5, S(SE_ARNG)}, {0x00D6, S(SE_ODIA)},
+    {0x00E4, SE_ADIA},  {0x00E5, SE_ARNG},  {0x00F6, SE_ODIA},  {0x20AC, SE_EURO},
+};
+
+// Dead keys on the Swedish layout, followed by a space to come out on their own
+static bool se_dead(uint16_t code) {
+    return code == SE_GRV || code == SE_CIRC || code == SE_TILD;
+}
+
+static uint16_t se_lookup(uint16_t cp) {
+    if (cp < 128) {
+        return pgm_read_word(&se_ascii[cp]);
+    }
+    for (uint8_t i = 0; i < ARRAY_SIZE(se_extra); i++) {
+        if (pgm_read_word(&se_extra[i].cp) == cp) {
+            return pgm_read_word(&se_extra[i].code);
+        }
+    }
+    return 0;
+}
+
+// Report state while a string is sent: the mods in it and the key still down
+static uint8_t se_mods;
+static uint8_t se_key;
+static uint8_t se_delay;
+
+static void se_send(void) {
+    send_keyboard_report();
+    if (se_delay) {
+        wait_ms(se_delay);
+    }
+}
+
+// A change of mods or a repeated key needs a report of its own that lets go
+// of the last key, otherwise the release of one key and the press of the
+// next share a report.
+static void se_tap(uint16_t code) {
+    uint8_t mods = report_mods(code);
+    uint8_t key  = QK_MODS_GET_BASIC_KEYCODE(code);
+    if (se_key && (mods != se_mods || key == se_key)) {
+        del_key(se_key);
+        se_key = 0;
+        if (mods == se_mods) {
+            se_send();
+        }
+    }
+    if (mods != se_mods) {
+        set_weak_mods(mods);
+        se_mods = mods;
+        se_send();
+    }
+    if (se_key) {
+        del_key(se_key);
+    }
+    add_key(key);
+    se_key = key;
+    se_send();
+}
+
+static void se_string(const char *str, bool progmem, uint8_t delay) {
+    uint8_t held = get_mods();
+    uint8_t weak = get_weak_mods();
+    clear_mods();
+    clear_weak_mods();
+    se_mods  = 0;
+    se_key   = 0;
+    se_delay = delay;
+
+    for (;;) {
+        uint8_t c = progmem ? pgm_read_byte(str++) : *str++;
+        if (!c) {
+            break;
+        }
+        // Two and three byte UTF-8 sequences, enough for the table above
+        uint16_t cp = c;
+        if ((c & 0xE0) == 0xC0 || (c & 0xF0) == 0xE0) {
+            uint8_t more = (c & 0xE0) == 0xC0 ? 1 : 2;
+            cp           = c & (more == 1 ? 0x1F : 0x0F);
+            while (more--) {
+                c = progmem ? pgm_read_byte(str) : *str;
+                if ((c & 0xC0) != 0x80) {
+                    break;
+                }
+                str++;
+                cp = cp << 6 | (c & 0x3F);
+            }
+        }
+
+        uint16_t code = se_lookup(cp);
+        if (code) {
+            se_tap(code);
+            if (se_dead(code)) {
+                se_tap(KC_SPC);
+            }
+        }
+    }
+
+    if (se_key) {
+        del_key(se_key);
+    }
+    set_mods(held);
+    set_weak_mods(weak);
+    send_keyboard_report();
+}
+
+void send_se_with_delay(const char *str, uint8_t delay) {
+    se_string(str, false, delay);
+}
+
+void send_se(const char *str) {
+    se_string(str, false, SEND_SE_DELAY);
+}
+
+void send_se_P(const char *str) {
+    se_string(str, true, SEND_SE_DELAY);
+}
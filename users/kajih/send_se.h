@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+#include "report_tap.h"
+
+// String output for a Swedish host layout. Every character is looked up in a
+// compile time table of keycodes with their Shift/AltGr mods, and runs of
+// characters needing the same mods share them, so the reports only change
+// mods between runs. ASCII plus å ä ö Å Ä Ö § ¤ £ ½ € as UTF-8, the rest is
+// skipped. Held mods are left out while the string is sent and put back after.
+//
+// SEND_SE_DELAY is the wait in ms after each report, 0 sends as fast as the
+// host polls.
+#ifndef SEND_SE_DELAY
+#    define SEND_SE_DELAY 0
+#endif
+
+void send_se(const char *str);
+void send_se_P(const char *str);
+void send_se_with_delay(const char *str, uint8_t delay);
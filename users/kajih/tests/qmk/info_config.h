@@ -0,0 +1,5 @@
+#pragma once
+
+// Forced into every file like the one QMK generates from info.json
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 8
@@ -0,0 +1,24 @@
+#pragma once
+
+// QMK_KEYBOARD_H for the tests: the Kyria's 50 key LAYOUT() on the matrix of
+// info_config.h, left half on rows 0-3, right half mirrored on rows 4-7
+
+#include "quantum.h"
+
+// clang-format off
+#define LAYOUT( \
+    L00, L01, L02, L03, L04, L05,                                         R05, R04, R03, R02, R01, R00, \
+    L10, L11, L12, L13, L14, L15,                                         R15, R14, R13, R12, R11, R10, \
+    L20, L21, L22, L23, L24, L25, L26, L27,                     R27, R26, R25, R24, R23, R22, R21, R20, \
+                        L32, L33, L34, L35, L36,           R36, R35, R34, R33, R32 \
+) { \
+    { L00, L01, L02, L03, L04, L05, 0,   0   }, \
+    { L10, L11, L12, L13, L14, L15, 0,   0   }, \
+    { L20, L21, L22, L23, L24, L25, L26, L27 }, \
+    { 0,   0,   L32, L33, L34, L35, L36, 0   }, \
+    { R00, R01, R02, R03, R04, R05, 0,   0   }, \
+    { R10, R11, R12, R13, R14, R15, 0,   0   }, \
+    { R20, R21, R22, R23, R24, R25, R26, R27 }, \
+    { 0,   0,   R32, R33, R34, R35, R36, 0   }  \
+}
+// clang-format on
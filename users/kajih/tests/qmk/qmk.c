@@ -0,0 +1,159 @@
+#include "test.h"
+#include "geometry.h"
+
+int test_failures;
+
+uint16_t timer_now;
+
+report_keyboard_t reports[REPORTS_MAX];
+uint16_t          report_count;
+
+keyevent_t executed[EXECUTED_MAX];
+uint8_t    executed_count;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state = 1;
+
+static report_keyboard_t  report;
+report_keyboard_t        *keyboard_report = &report;
+
+static void usb_send_keyboard(report_keyboard_t *sent) {
+    if (report_count < REPORTS_MAX) {
+        reports[report_count++] = *sent;
+    }
+}
+
+static void usb_send_nkro(report_nkro_t *sent) {}
+static void usb_send_mouse(report_mouse_t *sent) {}
+static void usb_send_extra(report_extra_t *sent) {}
+
+static host_driver_t usb_driver = {
+    .send_keyboard = usb_send_keyboard,
+    .send_nkro     = usb_send_nkro,
+    .send_mouse    = usb_send_mouse,
+    .send_extra    = usb_send_extra,
+};
+
+static host_driver_t *driver = &usb_driver;
+
+void qmk_reset(void) {
+    timer_now           = 0;
+    report_count        = 0;
+    executed_count      = 0;
+    layer_state         = 0;
+    default_layer_state = 1;
+    memset(&report, 0, sizeof(report));
+}
+
+uint16_t timer_read(void) {
+    return timer_now;
+}
+
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(timer_now - last);
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+    uint8_t layer = 0;
+    while (state >>= 1) {
+        layer++;
+    }
+    return layer;
+}
+
+void layer_or(layer_state_t state) {
+    layer_state |= state;
+}
+
+void layer_and(layer_state_t state) {
+    layer_state &= state;
+}
+
+host_driver_t *host_get_driver(void) {
+    return driver;
+}
+
+void host_set_driver(host_driver_t *next) {
+    driver = next;
+}
+
+// 5 bit keycode mods to report mods
+static uint8_t mod_bits(uint8_t mods) {
+    return mods & 0x10 ? (mods & 0x0F) << 4 : mods;
+}
+
+// Like QMK's add_key()/del_key() plus send_keyboard_report(), first free slot
+static void code16(uint16_t code, bool down) {
+    uint8_t mods = IS_QK_MODS(code) ? mod_bits(QK_MODS_GET_MODS(code)) : 0;
+    uint8_t key  = QK_MODS_GET_BASIC_KEYCODE(code);
+
+    if (IS_MODIFIER_KEYCODE(key)) {
+        mods |= 1 << (key & 7);
+        key = KC_NO;
+    }
+    report.mods = down ? report.mods | mods : report.mods & ~mods;
+    for (uint8_t i = 0; key && i < KEYBOARD_REPORT_KEYS; i++) {
+        if (down ? report.keys[i] == KC_NO : report.keys[i] == key) {
+            report.keys[i] = down ? key : KC_NO;
+            break;
+        }
+    }
+    driver->send_keyboard(&report);
+}
+
+void register_code16(uint16_t code) {
+    code16(code, true);
+}
+
+void unregister_code16(uint16_t code) {
+    code16(code, false);
+}
+
+void register_mods(uint8_t mods) {
+    report.mods |= mods;
+    driver->send_keyboard(&report);
+}
+
+void unregister_mods(uint8_t mods) {
+    report.mods &= ~mods;
+    driver->send_keyboard(&report);
+}
+
+uint8_t get_mods(void) {
+    return report.mods;
+}
+
+void action_exec(keyevent_t event) {
+    if (executed_count < EXECUTED_MAX) {
+        executed[executed_count++] = event;
+    }
+}
+
+void oled_write_P(const char *data, bool invert) {}
+
+keyevent_t key_event(uint8_t index, bool pressed) {
+    uint8_t pos = geo_pos(index);
+    return (keyevent_t){
+        .key     = {.row = pos / MATRIX_COLS, .col = pos % MATRIX_COLS},
+        .time    = timer_now,
+        .type    = KEY_EVENT,
+        .pressed = pressed,
+    };
+}
+
+keyrecord_t key_record(uint8_t index, bool pressed) {
+    return (keyrecord_t){.event = key_event(index, pressed)};
+}
+
+bool report_has(const report_keyboard_t *sent, uint8_t usage) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (sent->keys[i] == usage) {
+            return true;
+        }
+    }
+    return false;
+}
+
+report_keyboard_t last_report(void) {
+    return report_count ? reports[report_count - 1] : (report_keyboard_t){0};
+}
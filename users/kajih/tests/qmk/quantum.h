@@ -0,0 +1,240 @@
+#pragma once
+
+// The part of QMK's API the tested modules use, with the same names and
+// keycode values. qmk.c implements it on top of a recorded event log.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) s
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define memcpy_P memcpy
+
+// Matrix events
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef enum { TICK_EVENT = 0, KEY_EVENT = 1, COMBO_EVENT = 4 } keyevent_type_t;
+
+typedef struct {
+    keypos_t        key;
+    uint16_t        time;
+    keyevent_type_t type;
+    bool            pressed;
+} keyevent_t;
+
+typedef struct {
+    bool    interrupted : 1;
+    bool    reserved2 : 1;
+    bool    reserved1 : 1;
+    bool    reserved0 : 1;
+    uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+    uint16_t   keycode;
+} keyrecord_t;
+
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+
+// Keycodes
+
+enum {
+    KC_NO = 0x00,
+    KC_A  = 0x04,
+    KC_B,
+    KC_C,
+    KC_D,
+    KC_E,
+    KC_F,
+    KC_G,
+    KC_H,
+    KC_I,
+    KC_J,
+    KC_K,
+    KC_L,
+    KC_M,
+    KC_N,
+    KC_O,
+    KC_P,
+    KC_Q,
+    KC_R,
+    KC_S,
+    KC_T,
+    KC_U,
+    KC_V,
+    KC_W,
+    KC_X,
+    KC_Y,
+    KC_Z,
+    KC_1,
+    KC_2,
+    KC_3,
+    KC_4,
+    KC_5,
+    KC_6,
+    KC_7,
+    KC_8,
+    KC_9,
+    KC_0,
+    KC_ENTER,
+    KC_ESCAPE       = 0x29,
+    KC_BACKSPACE    = 0x2A,
+    KC_TAB          = 0x2B,
+    KC_SPACE        = 0x2C,
+    KC_MINUS        = 0x2D,
+    KC_LEFT_BRACKET = 0x2F,
+    KC_QUOTE        = 0x34,
+    KC_DOT          = 0x37,
+    KC_LEFT_CTRL    = 0xE0,
+    KC_LEFT_SHIFT,
+    KC_LEFT_ALT,
+    KC_LEFT_GUI,
+    KC_RIGHT_CTRL,
+    KC_RIGHT_SHIFT,
+    KC_RIGHT_ALT,
+    KC_RIGHT_GUI,
+};
+
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_QUOT KC_QUOTE
+#define KC_LSFT KC_LEFT_SHIFT
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x11
+#define MOD_RSFT 0x12
+#define MOD_RALT 0x14
+#define MOD_RGUI 0x18
+
+#define MOD_BIT_LSHIFT 0x02
+
+#define QK_BASIC_MAX 0x00FF
+#define QK_MODS 0x0100
+#define QK_MODS_MAX 0x1FFF
+#define QK_MOD_TAP 0x2000
+#define QK_MOD_TAP_MAX 0x3FFF
+#define QK_LAYER_TAP 0x4000
+#define QK_LAYER_TAP_MAX 0x4FFF
+#define QK_LAYER_MOD 0x5000
+#define QK_LAYER_MOD_MAX 0x51FF
+#define QK_MOMENTARY 0x5220
+#define QK_MOMENTARY_MAX 0x523F
+#define QK_LAYER_TAP_TOGGLE 0x52C0
+#define QK_LAYER_TAP_TOGGLE_MAX 0x52DF
+#define QK_TAP_DANCE 0x5700
+#define QK_TAP_DANCE_MAX 0x57FF
+#define SAFE_RANGE 0x7E40
+
+#define QK_LSFT 0x0200
+#define LSFT(kc) (QK_LSFT | (kc))
+#define MT(mod, kc) (QK_MOD_TAP | (((mod)&0x1F) << 8) | ((kc)&0xFF))
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer)&0xF) << 8) | ((kc)&0xFF))
+#define MO(layer) (QK_MOMENTARY | ((layer)&0x1F))
+#define TD(n) (QK_TAP_DANCE | ((n)&0xFF))
+
+#define IS_QK_BASIC(code) ((code) <= QK_BASIC_MAX)
+#define IS_QK_MODS(code) ((code) >= QK_MODS && (code) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(code) ((code) >= QK_MOD_TAP && (code) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(code) ((code) >= QK_LAYER_TAP && (code) <= QK_LAYER_TAP_MAX)
+#define IS_QK_LAYER_MOD(code) ((code) >= QK_LAYER_MOD && (code) <= QK_LAYER_MOD_MAX)
+#define IS_QK_MOMENTARY(code) ((code) >= QK_MOMENTARY && (code) <= QK_MOMENTARY_MAX)
+#define IS_QK_LAYER_TAP_TOGGLE(code) ((code) >= QK_LAYER_TAP_TOGGLE && (code) <= QK_LAYER_TAP_TOGGLE_MAX)
+#define IS_QK_TAP_DANCE(code) ((code) >= QK_TAP_DANCE && (code) <= QK_TAP_DANCE_MAX)
+#define IS_MODIFIER_KEYCODE(code) ((code) >= KC_LEFT_CTRL && (code) <= KC_RIGHT_GUI)
+
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc)&0xFF)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc)&0xFF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc)&0xFF)
+#define QK_TAP_DANCE_GET_INDEX(kc) ((kc)&0xFF)
+
+// Layers
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+uint8_t get_highest_layer(layer_state_t state);
+void    layer_or(layer_state_t state);
+void    layer_and(layer_state_t state);
+
+// Timer, advanced by the tests
+
+uint16_t timer_read(void);
+uint16_t timer_elapsed(uint16_t last);
+
+// Reports and the host driver
+
+#define KEYBOARD_REPORT_KEYS 6
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[KEYBOARD_REPORT_KEYS];
+} report_keyboard_t;
+
+typedef struct {
+    uint8_t mods;
+    uint8_t bits[30];
+} report_nkro_t;
+
+typedef struct {
+    uint8_t buttons;
+} report_mouse_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t usage;
+} report_extra_t;
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *);
+    void (*send_nkro)(report_nkro_t *);
+    void (*send_mouse)(report_mouse_t *);
+    void (*send_extra)(report_extra_t *);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void           host_set_driver(host_driver_t *driver);
+
+extern report_keyboard_t *keyboard_report;
+
+void register_code16(uint16_t code);
+void unregister_code16(uint16_t code);
+// Report mods, 8 bit
+void    register_mods(uint8_t mods);
+void    unregister_mods(uint8_t mods);
+uint8_t get_mods(void);
+
+// Everything QMK would run through its own pipeline ends up here
+void action_exec(keyevent_t event);
+
+void oled_write_P(const char *data, bool invert);
+
+// User hooks, called by the tests where QMK would call them
+void keyboard_post_init_user(void);
+void housekeeping_task_user(void);
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record);
+bool process_record_user(uint16_t keycode, keyrecord_t *record);
+
+// The keyboard's LAYOUT(), quantum.h brings it in for the userspace too
+#include "kyria.h"
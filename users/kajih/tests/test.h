@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "quantum.h"
+
+// Checks keep going after a failure, main() returns test_failures != 0
+extern int test_failures;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+// State of the fake QMK, reset by qmk_reset()
+extern uint16_t timer_now;
+
+// Keyboard reports that reached the USB driver, in order
+#define REPORTS_MAX 4096
+extern report_keyboard_t reports[REPORTS_MAX];
+extern uint16_t          report_count;
+
+// Events handed to action_exec(), in order
+#define EXECUTED_MAX 64
+extern keyevent_t executed[EXECUTED_MAX];
+extern uint8_t    executed_count;
+
+void qmk_reset(void);
+
+// Key event for a layout index (see geometry.h) at the current time
+keyevent_t key_event(uint8_t index, bool pressed);
+// Same thing as QMK hands it to the record hooks
+keyrecord_t key_record(uint8_t index, bool pressed);
+
+bool report_has(const report_keyboard_t *report, uint8_t usage);
+// The last report sent, an empty one before any
+report_keyboard_t last_report(void);
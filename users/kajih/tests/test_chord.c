@@ -0,0 +1,158 @@
+// Chord timing: the term running out, presses that end up in no chord going
+// on in their order, releases before the term, releases of other keys while
+// presses wait and the layer masks.
+
+#include "test.h"
+#include "chord.h"
+
+#define LAYER_NAV 2
+#define LAYER_SYM 3
+
+const chord_t chords[] = {
+    CHORD(KC_ESC, 1, 2),
+    CHORD(KC_TAB, 13, 14, 15),
+    CHORD_ON(1 << LAYER_NAV, KC_ENT, 1, 2),
+};
+const uint8_t chord_count = sizeof(chords) / sizeof(chords[0]);
+
+// One key event through the chord engine and on to QMK if it lets it pass
+static void key(uint8_t index, bool pressed) {
+    keyrecord_t record = key_record(index, pressed);
+    if (chord_process(&record)) {
+        action_exec(record.event);
+    }
+}
+
+// Time passing without key events, chord_task() runs every millisecond
+static void wait(uint16_t ms) {
+    while (ms--) {
+        timer_now++;
+        chord_task();
+    }
+}
+
+static bool executed_is(uint8_t i, uint8_t index, bool pressed) {
+    keyevent_t event = key_event(index, pressed);
+    return i < executed_count && executed[i].key.row == event.key.row && executed[i].key.col == event.key.col &&
+           executed[i].pressed == pressed;
+}
+
+static void test_fires(void) {
+    qmk_reset();
+    key(1, true);
+    wait(5);
+    key(2, true);
+    CHECK(executed_count == 0);
+    CHECK(report_count == 1 && report_has(&reports[0], KC_ESC));
+
+    // The first release ends the chord, the other one is swallowed
+    key(1, false);
+    CHECK(report_count == 2 && !report_has(&reports[1], KC_ESC));
+    key(2, false);
+    CHECK(executed_count == 0 && report_count == 2);
+}
+
+static void test_term(void) {
+    qmk_reset();
+    wait(10);
+    key(1, true);
+    wait(CHORD_TERM - 1);
+    CHECK(executed_count == 0);
+    wait(1);
+    CHECK(executed_count == 1 && executed_is(0, 1, true));
+    // Sent on with the time it was pressed at
+    CHECK(executed[0].time == 10);
+
+    key(1, false);
+    CHECK(executed_count == 2 && executed_is(1, 1, false) && report_count == 0);
+}
+
+static void test_replay_order(void) {
+    qmk_reset();
+    key(13, true);
+    wait(3);
+    key(14, true);
+    wait(3);
+    key(20, true);
+    CHECK(executed_count == 3);
+    CHECK(executed_is(0, 13, true) && executed_is(1, 14, true) && executed_is(2, 20, true));
+    CHECK(executed[0].time == 0 && executed[1].time == 3);
+
+    // A key of another chord ends the wait the same way
+    key(13, false);
+    key(14, false);
+    key(20, false);
+    executed_count = 0;
+    key(1, true);
+    key(13, true);
+    CHECK(executed_count == 2 && executed_is(0, 1, true) && executed_is(1, 13, true));
+    key(1, false);
+    key(13, false);
+    CHECK(report_count == 0);
+}
+
+static void test_release_before_term(void) {
+    qmk_reset();
+    key(1, true);
+    wait(CHORD_TERM / 2);
+    key(1, false);
+    CHECK(executed_count == 2 && executed_is(0, 1, true) && executed_is(1, 1, false));
+
+    // Part of a three key chord, the press still goes out before the release
+    executed_count = 0;
+    key(13, true);
+    key(14, true);
+    key(14, false);
+    CHECK(executed_count == 3);
+    CHECK(executed_is(0, 13, true) && executed_is(1, 14, true) && executed_is(2, 14, false));
+    key(13, false);
+    wait(CHORD_TERM);
+    CHECK(executed_count == 4 && executed_is(3, 13, false) && report_count == 0);
+
+    // A key held from before lets go while a chord key waits: the waiting
+    // press goes out first, as when a home-row mod-tap rolls into a chord key
+    executed_count = 0;
+    key(20, true);
+    key(1, true);
+    CHECK(executed_count == 1);
+    key(20, false);
+    CHECK(executed_count == 3);
+    CHECK(executed_is(0, 20, true) && executed_is(1, 1, true) && executed_is(2, 20, false));
+    key(1, false);
+    CHECK(executed_count == 4 && executed_is(3, 1, false) && report_count == 0);
+}
+
+static void test_layers(void) {
+    // Above the base layers an unmasked chord does not wait at all
+    qmk_reset();
+    layer_state = 1 << LAYER_SYM;
+    key(1, true);
+    CHECK(executed_count == 1 && executed_is(0, 1, true));
+    key(2, true);
+    CHECK(executed_count == 2 && report_count == 0);
+    key(1, false);
+    key(2, false);
+
+    // A masked one fires only on its own layer
+    qmk_reset();
+    layer_state = 1 << LAYER_NAV;
+    key(1, true);
+    key(2, true);
+    CHECK(executed_count == 0 && report_count == 1);
+    CHECK(report_has(&reports[0], KC_ENT) && !report_has(&reports[0], KC_ESC));
+    key(1, false);
+    key(2, false);
+    CHECK(report_count == 2);
+}
+
+int main(void) {
+    chord_init();
+
+    test_fires();
+    test_term();
+    test_replay_order();
+    test_release_before_term();
+    test_layers();
+
+    return test_failures != 0;
+}
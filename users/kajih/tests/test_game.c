@@ -0,0 +1,107 @@
+// Game mode sends a press in the matrix scan that saw it, on the keys that
+// otherwise wait for the tapping term, a second tap or a chord.
+
+#include "test.h"
+#include "kajih.h"
+
+// The rev3 kajih keymap's keys, at their layout indices
+#define CTL_ESC MT(MOD_LCTL, KC_ESC)
+#define ALT_ENT MT(MOD_LALT, KC_ENT)
+#define SE_LPRN LSFT(KC_8)
+
+enum { TD_LBRC };
+
+#define CTL_ESC_KEY 12
+#define ALT_ENT_KEY 42
+#define TD_LBRC_KEY 30
+#define GAME_KEY 49
+
+// A chord on CTL_ESC, so outside game mode its press waits here as well
+const chord_t chords[]    = {CHORD(KC_TAB, CTL_ESC_KEY, 13)};
+const uint8_t chord_count = 1;
+
+uint16_t game_tap_dance_keycode(uint8_t index) {
+    return index == TD_LBRC ? SE_LPRN : KC_NO;
+}
+
+// One matrix scan with one key event: the record hooks, QMK's action pipeline
+// for what they pass on, then the housekeeping task. Returns the reports the
+// host got during the scan.
+static uint16_t scan(uint8_t index, uint16_t keycode, bool pressed) {
+    uint16_t before = report_count;
+
+    timer_now++;
+    keyrecord_t record = key_record(index, pressed);
+    if (pre_process_record_user(keycode, &record)) {
+        // The tapping engine and process_tap_dance() hold these keys back,
+        // nothing reaches the host from here before the key is decided
+        action_exec(record.event);
+    }
+    housekeeping_task_user();
+    return report_count - before;
+}
+
+static void test_press_in_same_scan(uint8_t index, uint16_t keycode, uint8_t usage, uint8_t mods) {
+    uint8_t executed_before = executed_count;
+
+    CHECK(scan(index, keycode, true) == 1);
+    report_keyboard_t report = last_report();
+    CHECK(report_has(&report, usage));
+    CHECK(report.mods == mods);
+
+    CHECK(scan(index, keycode, false) == 1);
+    report = last_report();
+    CHECK(!report_has(&report, usage));
+    CHECK(report.mods == 0);
+
+    CHECK(executed_count == executed_before);
+}
+
+static void test_outside_game_mode(void) {
+    // Held back by the chord, then by the tapping engine: no report yet
+    CHECK(scan(CTL_ESC_KEY, CTL_ESC, true) == 0);
+    CHECK(scan(CTL_ESC_KEY, CTL_ESC, false) == 0);
+    CHECK(scan(ALT_ENT_KEY, ALT_ENT, true) == 0);
+    CHECK(scan(ALT_ENT_KEY, ALT_ENT, false) == 0);
+}
+
+static void test_roll(void) {
+    CHECK(scan(CTL_ESC_KEY, CTL_ESC, true) == 1);
+    CHECK(scan(ALT_ENT_KEY, ALT_ENT, true) == 1);
+    report_keyboard_t report = last_report();
+    CHECK(report_has(&report, KC_ESC) && report_has(&report, KC_ENT));
+    CHECK(scan(CTL_ESC_KEY, CTL_ESC, false) == 1);
+    CHECK(scan(ALT_ENT_KEY, ALT_ENT, false) == 1);
+    report = last_report();
+    CHECK(!report_has(&report, KC_ESC) && !report_has(&report, KC_ENT));
+}
+
+// A key held while game mode goes off is released as what it sent
+static void test_release_after_toggle(void) {
+    CHECK(scan(TD_LBRC_KEY, TD(TD_LBRC), true) == 1);
+    scan(GAME_KEY, GAME, true);
+    scan(GAME_KEY, GAME, false);
+    CHECK(!game_mode_active());
+    CHECK(scan(TD_LBRC_KEY, TD(TD_LBRC), false) == 1);
+    report_keyboard_t report = last_report();
+    CHECK(!report_has(&report, KC_8) && report.mods == 0);
+}
+
+int main(void) {
+    keyboard_post_init_user();
+
+    test_outside_game_mode();
+
+    qmk_reset();
+    scan(GAME_KEY, GAME, true);
+    scan(GAME_KEY, GAME, false);
+    CHECK(game_mode_active());
+
+    test_press_in_same_scan(CTL_ESC_KEY, CTL_ESC, KC_ESC, 0);
+    test_press_in_same_scan(ALT_ENT_KEY, ALT_ENT, KC_ENT, 0);
+    test_press_in_same_scan(TD_LBRC_KEY, TD(TD_LBRC), KC_8, MOD_BIT_LSHIFT);
+    test_roll();
+    test_release_after_toggle();
+
+    return test_failures != 0;
+}
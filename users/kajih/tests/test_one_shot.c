@@ -0,0 +1,125 @@
+// One-shot triggers reached through a layer-tap thumb, as on callum's mod
+// layers. QMK calls pre_process_record_user with the keycode of the layers on
+// when the event comes in, before the tapping engine, and process_record_user
+// with the keycode once the thumb is decided. A trigger tapped quickly under
+// the thumb only turns into the trigger at the second step.
+
+#include "test.h"
+#include "kajih.h"
+
+#define _QMOL 1
+#define _NUM 6
+
+// callum's left thumb and the key under the index finger
+#define MODL_KEY 43
+#define MODL LT(_QMOL, KC_ENT)
+#define F_KEY 16
+#define J_KEY 19
+
+static void pre(uint8_t index, uint16_t keycode, bool pressed) {
+    keyrecord_t record = key_record(index, pressed);
+    CHECK(pre_process_record_user(keycode, &record));
+}
+
+static bool process(uint8_t index, uint16_t keycode, bool pressed, uint8_t taps) {
+    keyrecord_t record = key_record(index, pressed);
+    record.tap.count   = taps;
+    return process_record_user(keycode, &record);
+}
+
+// A plain key the rest of QMK would send
+static void type(uint8_t index, uint16_t keycode, bool pressed) {
+    pre(index, keycode, pressed);
+    if (process(index, keycode, pressed, 0)) {
+        (pressed ? register_code16 : unregister_code16)(keycode);
+    }
+}
+
+static void test_quick_tap_under_thumb(void) {
+    qmk_reset();
+
+    // Thumb, trigger down and up within the tapping term: the tapping
+    // engine holds all three back, pre_process sees F
+    pre(MODL_KEY, MODL, true);
+    pre(F_KEY, KC_F, true);
+    pre(F_KEY, KC_F, false);
+
+    // The term runs out, the thumb is a hold and the held back trigger is
+    // read from _QMOL, release included
+    CHECK(process(MODL_KEY, MODL, true, 0));
+    layer_or(1 << _QMOL);
+    CHECK(!process(F_KEY, OSM_LSFT, true, 0));
+    CHECK(get_mods() == MOD_BIT_LSHIFT);
+    CHECK(!process(F_KEY, OSM_LSFT, false, 0));
+    CHECK(get_mods() == MOD_BIT_LSHIFT);
+
+    pre(MODL_KEY, MODL, false);
+    CHECK(process(MODL_KEY, MODL, false, 0));
+    layer_and(~(1 << _QMOL));
+    CHECK(get_mods() == MOD_BIT_LSHIFT);
+
+    // The next key gets Shift and takes it off with its release
+    type(J_KEY, KC_J, true);
+    report_keyboard_t report = last_report();
+    CHECK(report_has(&report, KC_J) && report.mods == MOD_BIT_LSHIFT);
+    type(J_KEY, KC_J, false);
+    CHECK(get_mods() == 0);
+}
+
+// The same keys when the thumb ends up a tap: plain Enter and F, nothing on
+static void test_thumb_tapped(void) {
+    qmk_reset();
+    pre(MODL_KEY, MODL, true);
+    pre(F_KEY, KC_F, true);
+    pre(MODL_KEY, MODL, false);
+    CHECK(process(MODL_KEY, MODL, true, 1));
+    CHECK(process(F_KEY, KC_F, true, 0));
+    CHECK(process(MODL_KEY, MODL, false, 1));
+    pre(F_KEY, KC_F, false);
+    CHECK(process(F_KEY, KC_F, false, 0));
+    CHECK(get_mods() == 0 && layer_state == 0);
+}
+
+static void test_held_trigger(void) {
+    qmk_reset();
+    layer_or(1 << _QMOL);
+    process(F_KEY, OSM_LCTL, true, 0);
+    type(J_KEY, KC_J, true);
+    type(J_KEY, KC_J, false);
+    CHECK(get_mods() == 0x01);
+    type(J_KEY, KC_J, true);
+    type(J_KEY, KC_J, false);
+    CHECK(get_mods() == 0x01);
+    // Used, so its release ends it
+    process(F_KEY, OSM_LCTL, false, 0);
+    CHECK(get_mods() == 0);
+}
+
+static void test_stacked_and_cancel(void) {
+    qmk_reset();
+    process(F_KEY, OSM_LCTL, true, 0);
+    process(F_KEY, OSM_LCTL, false, 0);
+    process(F_KEY, OSM_RALT, true, 0);
+    process(F_KEY, OSM_RALT, false, 0);
+    process(F_KEY, OSLAYER(_NUM), true, 0);
+    process(F_KEY, OSLAYER(_NUM), false, 0);
+    CHECK(get_mods() == (0x01 | 0x40) && layer_state == 1 << _NUM);
+
+    // A held hold-tap leaves them on, the thumb layer key too
+    CHECK(process(MODL_KEY, MODL, true, 0));
+    CHECK(process(MODL_KEY, MODL, false, 0));
+    CHECK(get_mods() == (0x01 | 0x40));
+
+    process(F_KEY, OSCNCL, true, 0);
+    process(F_KEY, OSCNCL, false, 0);
+    CHECK(get_mods() == 0 && layer_state == 0);
+}
+
+int main(void) {
+    test_quick_tap_under_thumb();
+    test_thumb_tapped();
+    test_held_trigger();
+    test_stacked_and_cancel();
+
+    return test_failures != 0;
+}
@@ -0,0 +1,228 @@
+// report_batch.c on rolling typing: the host sees the same presses with the
+// same mods as without batching, in fewer reports. Prints reports per
+// keystroke, the number BATCH_GET gives on the keyboard.
+
+#include <stdlib.h>
+
+#include "test.h"
+#include "report_batch.h"
+
+#define SCAN_MS 1
+#define WPM 90
+#define HOLD_MS 110
+#define EVENTS_MAX 2048
+#define PRESSES_MAX 1024
+
+static const char roll_text[] = "The quick brown fox jumps over the lazy dog while five boxing wizards jump quickly. "
+                                "Pack my box with five dozen liquor jugs and sphinx of black quartz judge my vow. ";
+
+typedef struct {
+    uint32_t ms;
+    uint16_t order;
+    uint16_t keycode;
+    bool     pressed;
+} event_t;
+
+static event_t  events[EVENTS_MAX];
+static uint16_t event_count;
+
+// What the host makes of the reports: each new usage is a keystroke, taken
+// in slot order with the mods of its report
+typedef struct {
+    uint8_t usage;
+    uint8_t mods;
+} press_t;
+
+static uint32_t seed = 1;
+
+static uint32_t random_next(void) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+// Roughly normal, sum of four uniforms
+static int32_t random_spread(int32_t mean, int32_t spread) {
+    int32_t sum = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        sum += random_next() % 1001;
+    }
+    return mean + (sum - 2000) * spread / 1000;
+}
+
+static void add_event(uint32_t ms, uint16_t keycode, bool pressed) {
+    if (event_count < EVENTS_MAX) {
+        events[event_count] = (event_t){.ms = ms, .order = event_count, .keycode = keycode, .pressed = pressed};
+        event_count++;
+    }
+}
+
+static int event_cmp(const void *a, const void *b) {
+    const event_t *x = a, *y = b;
+    if (x->ms != y->ms) {
+        return x->ms < y->ms ? -1 : 1;
+    }
+    return x->order - y->order;
+}
+
+// Presses overlap the previous key's release, capitals come with a Shift
+// that goes down first and up half way through the letter
+static void roll_events(const char *text, uint8_t repeat) {
+    int32_t  gap = 60000 / (WPM * 5);
+    uint32_t t   = 100;
+
+    event_count = 0;
+    for (uint8_t r = 0; r < repeat; r++) {
+        for (const char *c = text; *c; c++) {
+            uint16_t keycode;
+            if (*c == ' ') {
+                keycode = KC_SPC;
+            } else if (*c == '.') {
+                keycode = KC_DOT;
+            } else if ((*c | 0x20) >= 'a' && (*c | 0x20) <= 'z') {
+                keycode = KC_A + (*c | 0x20) - 'a';
+            } else {
+                continue;
+            }
+            int32_t step = random_spread(gap, gap * 2 / 5);
+            int32_t hold = random_spread(HOLD_MS, HOLD_MS * 3 / 10);
+            t += step < 5 ? 5 : step;
+            hold = hold < 20 ? 20 : hold;
+            if (*c >= 'A' && *c <= 'Z') {
+                add_event(t - 25, KC_LSFT, true);
+                add_event(t + hold / 2, KC_LSFT, false);
+            }
+            add_event(t, keycode, true);
+            add_event(t + hold, keycode, false);
+        }
+    }
+    qsort(events, event_count, sizeof(events[0]), event_cmp);
+}
+
+// The key events of one scan back to back, then the housekeeping task.
+// Returns the scans with more than one key event.
+static uint16_t type_events(bool batched) {
+    uint16_t shared = 0;
+    uint16_t i      = 0;
+
+    qmk_reset();
+    while (i < event_count) {
+        uint32_t scan = events[i].ms / SCAN_MS;
+        uint16_t j    = i;
+        for (; j < event_count && events[j].ms / SCAN_MS == scan; j++) {
+            (events[j].pressed ? register_code16 : unregister_code16)(events[j].keycode);
+        }
+        shared += j - i > 1;
+        if (batched) {
+            report_batch_task();
+        }
+        i = j;
+    }
+    return shared;
+}
+
+static uint16_t host_presses(press_t *presses) {
+    report_keyboard_t last  = {0};
+    uint16_t          count = 0;
+
+    for (uint16_t r = 0; r < report_count; r++) {
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            uint8_t usage = reports[r].keys[i];
+            if (usage && !report_has(&last, usage) && count < PRESSES_MAX) {
+                presses[count++] = (press_t){.usage = usage, .mods = reports[r].mods};
+            }
+        }
+        last = reports[r];
+    }
+    return count;
+}
+
+static press_t unbatched[PRESSES_MAX];
+static press_t batched[PRESSES_MAX];
+
+static void test_rolls(void) {
+    roll_events(roll_text, 4);
+
+    uint16_t shared         = type_events(false);
+    uint16_t unbatched_sent = report_count;
+    uint16_t keystrokes     = host_presses(unbatched);
+
+    // The first task call wraps the USB driver
+    report_batch_task();
+    report_batch_reset();
+    type_events(true);
+    CHECK(host_presses(batched) == keystrokes);
+    CHECK(memcmp(batched, unbatched, keystrokes * sizeof(press_t)) == 0);
+
+    report_keyboard_t report = last_report(), empty = {0};
+    CHECK(memcmp(&report, &empty, sizeof(report)) == 0);
+    CHECK(report_batch_stats.submitted == unbatched_sent);
+    CHECK(report_batch_stats.sent == report_count);
+    CHECK(report_batch_stats.presses == keystrokes);
+    CHECK(shared > 0 && report_count < unbatched_sent);
+
+    printf("keystrokes     %u\n", keystrokes);
+    printf("shared scans   %u with more than one key event\n", shared);
+    printf("unbatched      %u reports, %.3f per keystroke\n", unbatched_sent, (double)unbatched_sent / keystrokes);
+    printf("batched        %u reports, %.3f per keystroke\n", report_count, (double)report_count / keystrokes);
+}
+
+// A burst in one scan, like the tapping engine sending the keys it held
+// back: releases and presses merge, a press into an earlier slot does not
+static void test_burst(void) {
+    qmk_reset();
+    register_code16(KC_T);
+    unregister_code16(KC_T);
+    register_code16(KC_H);
+    report_batch_task();
+    CHECK(report_count == 2);
+    CHECK(report_has(&reports[0], KC_T));
+    CHECK(report_has(&reports[1], KC_H) && !report_has(&reports[1], KC_T));
+
+    // H sits in slot 0, E goes to slot 1 and merges, T then lands in slot 0
+    // before E and has to wait for a report of its own
+    qmk_reset();
+    register_code16(KC_H);
+    report_batch_task();
+    register_code16(KC_E);
+    unregister_code16(KC_H);
+    register_code16(KC_T);
+    report_batch_task();
+    CHECK(report_count == 3);
+    CHECK(report_has(&reports[1], KC_E) && !report_has(&reports[1], KC_T));
+    CHECK(report_has(&reports[2], KC_T) && report_has(&reports[2], KC_E));
+    unregister_code16(KC_E);
+    unregister_code16(KC_T);
+    report_batch_task();
+
+    // Shift after an unsent press goes out after it
+    qmk_reset();
+    register_code16(KC_A);
+    register_code16(KC_LSFT);
+    report_batch_task();
+    CHECK(report_count == 2 && reports[0].mods == 0 && reports[1].mods == MOD_BIT_LSHIFT);
+    unregister_code16(KC_LSFT);
+    unregister_code16(KC_A);
+    report_batch_task();
+}
+
+// Other reports send the held keyboard report first
+static void test_other_reports(void) {
+    qmk_reset();
+    register_code16(KC_A);
+    CHECK(report_count == 0);
+    report_mouse_t mouse = {.buttons = 1};
+    host_get_driver()->send_mouse(&mouse);
+    CHECK(report_count == 1 && report_has(&reports[0], KC_A));
+    unregister_code16(KC_A);
+    report_batch_task();
+}
+
+int main(void) {
+    test_rolls();
+    test_burst();
+    test_other_reports();
+
+    return test_failures != 0;
+}
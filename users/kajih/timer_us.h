@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+
+// ChibiOS runs the system tick at 1MHz on the RP2040, good enough for loop timing
+static inline uint32_t timer_us_read(void) {
+    return TIME_I2US(chVTGetSystemTimeX());
+}
+#else
+#    include "timer.h"
+
+// Only the ms timer to go on: values are in us but move in 1000us steps,
+// too coarse for loop times
+#    define TIMER_US_COARSE
+
+static inline uint32_t timer_us_read(void) {
+    return timer_read32() * 1000UL;
+}
+#endif
+
+static inline uint32_t timer_us_elapsed(uint32_t last) {
+    return timer_us_read() - last;
+}
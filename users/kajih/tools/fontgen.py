@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""Build the OLED font (glcdfont_kajih.c) from a BDF or PNG source.
+
+Only the glyphs the firmware can draw are emitted: the characters used in
+PSTR() strings of the keymaps built against this userspace and any --keep
+ranges (printable ASCII by default, the off-hand shows arbitrary host text). QMK's OLED driver indexes font[] by character, so the
+table covers OLED_FONT_START..OLED_FONT_END of the used set; glyphs inside
+that span that nothing uses are blanked, everything outside it is dropped.
+
+Static artwork such as the logo is pre-rendered from font cells into raw
+OLED pages (oled_art_kajih.h) and blitted by oled_art.c, so those cells do
+not need to be in the font.
+
+    fontgen.py                               regenerate from font/glcdfont_kajih.bdf
+    fontgen.py --source font.png             16x16 grid of 6x8 cells, light on dark
+    fontgen.py --export-bdf out.bdf          dump the current C table as BDF
+"""
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+WIDTH = 6
+HEIGHT = 8
+GLYPHS = 256
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+USERSPACE = os.path.dirname(HERE)
+REPO = os.path.dirname(os.path.dirname(USERSPACE))
+
+# Artwork drawn from font cells, one list of glyph codes per OLED page
+ARTWORK = {
+    'logo': [range(0x80, 0x95), range(0xA0, 0xB5), range(0xC0, 0xD5)],
+}
+DISPLAY_WIDTH = 128
+
+
+def parse_ranges(text):
+    ranges = []
+    for part in text.split(','):
+        if part:
+            lo, _, hi = part.partition('-')
+            ranges.append((int(lo, 0), int(hi or lo, 0)))
+    return ranges
+
+
+# Glyphs are lists of WIDTH column bytes, bit 0 is the top pixel row
+
+
+def read_c_table(path):
+    with open(path) as f:
+        body = f.read().split('{', 1)[1].split('}', 1)[0]
+    body = re.sub(r'//.*', '', body)
+    data = [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', body)]
+    glyphs = [None] * GLYPHS
+    for i in range(len(data) // WIDTH):
+        glyphs[i] = data[i * WIDTH:(i + 1) * WIDTH]
+    return glyphs
+
+
+def read_bdf(path):
+    glyphs = [None] * GLYPHS
+    code = None
+    rows = None
+    with open(path) as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            if words[0] == 'ENCODING':
+                code = int(words[1])
+            elif words[0] == 'BITMAP':
+                rows = []
+            elif words[0] == 'ENDCHAR':
+                if code is not None and 0 <= code < GLYPHS:
+                    rows += [0] * (HEIGHT - len(rows))
+                    glyphs[code] = [sum(((rows[y] >> (7 - x)) & 1) << y for y in range(HEIGHT)) for x in range(WIDTH)]
+                code = rows = None
+            elif rows is not None:
+                rows.append(int(words[0], 16))
+    return glyphs
+
+
+def write_bdf(path, glyphs):
+    present = [(c, g) for c, g in enumerate(glyphs) if g is not None]
+    with open(path, 'w') as f:
+        f.write('STARTFONT 2.1\nFONT -kajih-glcdfont-medium-r-normal--8-80-75-75-c-60-iso8859-1\n')
+        f.write('SIZE 8 75 75\nFONTBOUNDINGBOX %d %d 0 -1\n' % (WIDTH, HEIGHT))
+        f.write('STARTPROPERTIES 2\nFONT_ASCENT 7\nFONT_DESCENT 1\nENDPROPERTIES\n')
+        f.write('CHARS %d\n' % len(present))
+        for code, cols in present:
+            f.write('STARTCHAR c%02X\nENCODING %d\nSWIDTH 750 0\nDWIDTH %d 0\nBBX %d %d 0 -1\nBITMAP\n' % (code, code, WIDTH, WIDTH, HEIGHT))
+            for y in range(HEIGHT):
+                f.write('%02X\n' % sum(((cols[x] >> y) & 1) << (7 - x) for x in range(WIDTH)))
+            f.write('ENDCHAR\n')
+        f.write('ENDFONT\n')
+
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s is not a PNG' % path)
+    pos, idat, palette = 8, b'', None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [chunk[i:i + 3] for i in range(0, len(chunk), 3)]
+        elif kind == b'IDAT':
+            idat += chunk
+    if interlace or depth not in (1, 8):
+        raise ValueError('only non-interlaced 1 or 8 bit PNGs are supported')
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bpp = max(1, channels * depth // 8)
+    stride = (width * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    pixels = []
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+        row = []
+        for x in range(width):
+            if depth == 1:
+                value = (line[x // 8] >> (7 - x % 8)) & 1
+                row.append(value * 255 if ctype != 3 else sum(palette[value]) // 3)
+            else:
+                px = line[x * channels:(x + 1) * channels]
+                value = sum(palette[px[0]]) // 3 if ctype == 3 else sum(px[:3]) // len(px[:3]) if channels >= 3 else px[0]
+                row.append(value)
+        pixels.append(row)
+    if width < 16 * WIDTH or height < 16 * HEIGHT:
+        raise ValueError('expected a 16x16 grid of %dx%d cells' % (WIDTH, HEIGHT))
+    glyphs = [None] * GLYPHS
+    for code in range(GLYPHS):
+        ox, oy = (code % 16) * WIDTH, (code // 16) * HEIGHT
+        glyphs[code] = [sum((pixels[oy + y][ox + x] > 127) << y for y in range(HEIGHT)) for x in range(WIDTH)]
+    return glyphs
+
+
+def load(path):
+    if path.endswith('.png'):
+        return read_png(path)
+    if path.endswith('.c'):
+        return read_c_table(path)
+    return read_bdf(path)
+
+
+def userspace_keymaps():
+    """keymap.c files of keymaps that build against this userspace.
+
+    That is an explicit USER_NAME in the keymap's rules.mk, or no USER_NAME
+    in a keymap named after the userspace, which QMK falls back to.
+    """
+    name = os.path.basename(USERSPACE)
+    for keymap in glob.glob(os.path.join(REPO, 'keyboards', '**', 'keymaps', '*', 'keymap.c'), recursive=True):
+        rules = os.path.join(os.path.dirname(keymap), 'rules.mk')
+        source = open(rules).read() if os.path.exists(rules) else ''
+        user = re.search(r'^\s*USER_NAME\s*:?=\s*(\S+)\s*$', source, re.M)
+        if (user.group(1) if user else os.path.basename(os.path.dirname(keymap))) == name:
+            yield keymap
+
+
+def pstr_chars(paths):
+    escapes = {'n': 10, 'r': 13, 't': 9, '0': 0, '\\': 92, '"': 34, "'": 39}
+    used = set()
+    for path in paths:
+        with open(path, encoding='utf-8') as f:
+            source = f.read()
+        for literal in re.findall(r'PSTR\(\s*"((?:[^"\\]|\\.)*)"\s*\)', source):
+            i = 0
+            while i < len(literal):
+                if literal[i] == '\\':
+                    m = re.match(r'x([0-9A-Fa-f]{1,2})', literal[i + 1:])
+                    if m:
+                        used.add(int(m.group(1), 16))
+                        i += 2 + len(m.group(1))
+                        continue
+                    used.add(escapes.get(literal[i + 1], ord(literal[i + 1])))
+                    i += 2
+                else:
+                    used.add(ord(literal[i]))
+                    i += 1
+    # Control characters are handled by the driver, never drawn
+    return {c for c in used if 0x20 <= c < GLYPHS}
+
+
+def write_c(path, glyphs, start, end, used, source):
+    blank = [0] * WIDTH
+    with open(path, 'w') as f:
+        f.write('#include "progmem.h"\n\n')
+        f.write('// Generated by tools/fontgen.py from %s, do not edit.\n' % source)
+        f.write('// Covers 0x%02X-0x%02X, glyphs in that span nothing draws are blank.\n\n' % (start, end))
+        f.write('static const unsigned char PROGMEM font[] = {\n')
+        for code in range(start, end + 1):
+            cols = glyphs[code] if code in used and glyphs[code] is not None else blank
+            f.write('    %s, // 0x%02X\n' % (', '.join('0x%02X' % b for b in cols), code))
+        f.write('};\n')
+
+
+def write_header(path, start, end):
+    with open(path, 'w') as f:
+        f.write('// Generated by tools/fontgen.py, do not edit.\n#pragma once\n\n')
+        f.write('#define OLED_FONT_START 0x%02X\n#define OLED_FONT_END 0x%02X\n' % (start, end))
+
+
+def write_art(path, glyphs, source):
+    with open(path, 'w') as f:
+        f.write('// Generated by tools/fontgen.py from %s, do not edit.\n' % source)
+        f.write('// Raw OLED pages, %d bytes per page, bit 0 is the top pixel row.\n#pragma once\n\n#include "progmem.h"\n\n' % DISPLAY_WIDTH)
+        for name, pages in ARTWORK.items():
+            f.write('#define ART_%s_PAGES %d\n\n' % (name.upper(), len(pages)))
+            f.write('static const char PROGMEM art_%s[] = {\n' % name)
+            for page in pages:
+                data = [b for code in page for b in glyphs[code]]
+                if len(data) > DISPLAY_WIDTH:
+                    sys.exit('fontgen: %s page is %d columns wide' % (name, len(data)))
+                data += [0] * (DISPLAY_WIDTH - len(data))
+                for i in range(0, DISPLAY_WIDTH, 16):
+                    f.write('    %s,\n' % ', '.join('0x%02X' % b for b in data[i:i + 16]))
+            f.write('};\n\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source', default=os.path.join(USERSPACE, 'font', 'glcdfont_kajih.bdf'), help='BDF, PNG or existing C table')
+    parser.add_argument('--output', default=os.path.join(USERSPACE, 'glcdfont_kajih.c'))
+    parser.add_argument('--header', default=os.path.join(USERSPACE, 'glcdfont_kajih.h'))
+    parser.add_argument('--art', default=os.path.join(USERSPACE, 'oled_art_kajih.h'))
+    parser.add_argument('--keep', default='0x20-0x7E', help='extra ranges to keep, e.g. 0x20-0x7E,0xB0')
+    parser.add_argument('--export-bdf', metavar='FILE', help='write the source as BDF and exit')
+    args = parser.parse_args()
+
+    glyphs = load(args.source)
+    if args.export_bdf:
+        write_bdf(args.export_bdf, glyphs)
+        return
+
+    used = pstr_chars(list(userspace_keymaps()) + glob.glob(os.path.join(USERSPACE, '*.c')))
+    for lo, hi in parse_ranges(args.keep):
+        used.update(range(lo, hi + 1))
+    art_cells = {code for pages in ARTWORK.values() for page in pages for code in page}
+    missing = sorted(c for c in used | art_cells if glyphs[c] is None)
+    if missing:
+        sys.exit('fontgen: source has no glyph for %s' % ', '.join('0x%02X' % c for c in missing))
+
+    start, end = min(used), max(used)
+    source = os.path.relpath(args.source, USERSPACE)
+    write_c(args.output, glyphs, start, end, used, source)
+    write_header(args.header, start, end)
+    write_art(args.art, glyphs, source)
+
+    # QMK's default table covers 0x00-0xDF
+    size = (end - start + 1) * WIDTH
+    print('fontgen: %d glyphs used, 0x%02X-0x%02X, %d bytes (%d saved against the default 0x00-0xDF table)' % (len(used), start, end, size, 224 * WIDTH - size))
+
+
+if __name__ == '__main__':
+    main()
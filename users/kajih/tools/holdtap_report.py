@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Show the hold-tap press duration histograms recorded by the keyboard.
+
+One block per mod-tap/layer-tap key, rows by how the key resolved and
+whether another key interrupted it, columns are press duration buckets.
+Where the tap and hold rows overlap is where TAPPING_TERM and the
+permissive/hold-on-other-key settings decide.
+
+Misfires (a hold or tap dance corrected with Backspace right after) follow
+per key, when the firmware is built with MISFIRE_STATS_ENABLE.
+
+    holdtap_report.py               autodetect the keyboard
+    holdtap_report.py --json FILE   also save the histograms as JSON
+    holdtap_report.py --reset       clear the histograms after reading
+"""
+import argparse
+import json
+import sys
+
+import kajih_hid as hid
+
+MODS = {0x01: 'C', 0x02: 'S', 0x04: 'A', 0x08: 'G'}
+
+
+def describe(keycode):
+    """Short name for a QMK mod-tap or layer-tap keycode."""
+    if 0x2000 <= keycode <= 0x3FFF:
+        mods = (keycode >> 8) & 0x1F
+        name = ''.join(n for bit, n in MODS.items() if mods & bit)
+        return 'MT(%s%s, 0x%02X)' % ('R' if mods & 0x10 else 'L', name, keycode & 0xFF)
+    if 0x4000 <= keycode <= 0x4FFF:
+        return 'LT(%d, 0x%02X)' % ((keycode >> 8) & 0x0F, keycode & 0xFF)
+    return '0x%04X' % keycode
+
+
+def edges():
+    out = []
+    for i in range(hid.HOLDTAP_BUCKETS):
+        out.append('>=%d' % (1 << (hid.HOLDTAP_BUCKET_SHIFT + i - 1)) if i == hid.HOLDTAP_BUCKETS - 1
+                   else '<%d' % (1 << (hid.HOLDTAP_BUCKET_SHIFT + i)))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--device', help='hidraw node, autodetected by default')
+    parser.add_argument('--json', metavar='FILE', help='write the histograms to FILE as JSON')
+    parser.add_argument('--reset', action='store_true', help='clear the histograms and misfires after reading')
+    parser.add_argument('--loopback', action='store_true', help='talk to the in-process stand-in instead of a keyboard')
+    args = parser.parse_args()
+
+    if args.loopback:
+        import uhid_standin
+        client = hid.Client(uhid_standin.LoopbackTransport(uhid_standin.FirmwareModel()))
+    else:
+        client = hid.open_client(args.device)
+
+    client.hello()
+    keys = client.holdtap(args.reset)
+    try:
+        misfires = client.misfire(args.reset)
+    except hid.ProtocolError:
+        misfires = None
+    if not keys:
+        print('no hold-tap presses recorded')
+
+    header = '%-18s' % 'ms' + ''.join('%7s' % e for e in edges())
+    for key in sorted(keys, key=lambda k: k.index):
+        print('key %d %s' % (key.index, describe(key.keycode)))
+        print(header)
+        for kind, row in zip(hid.HOLDTAP_KINDS, key.hist):
+            print('%-18s' % kind + ''.join('%7d' % n for n in row))
+        print()
+
+    if misfires is not None:
+        rules = list(hid.MISFIRE_RULES)
+        rows = [(i, [misfires[r][i] for r in rules]) for i in range(hid.USAGE_KEYS)]
+        rows = [(i, counts) for i, counts in rows if any(counts)]
+        print('misfires: ' + ', '.join('%s %d' % (r, sum(misfires[r])) for r in rules))
+        if rows:
+            print('%-6s' % 'key' + ''.join('%11s' % r for r in rules))
+            for i, counts in rows:
+                print('%-6d' % i + ''.join('%11d' % n for n in counts))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'holdtap': [{'index': k.index, 'keycode': k.keycode,
+                                    'hist': dict(zip(hid.HOLDTAP_KINDS, k.hist))} for k in keys],
+                       'misfire': misfires}, f, indent=1)
+            f.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
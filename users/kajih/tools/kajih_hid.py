@@ -0,0 +1,224 @@
+"""Host side of the kajih raw HID protocol, see users/kajih/hid_protocol.h.
+
+Shared by the host tools in this directory. Talks to the keyboard through
+/dev/hidraw, or to anything else implementing send()/recv() such as the
+loopback stand-in in uhid_standin.py.
+"""
+import glob
+import os
+import select
+import struct
+from collections import namedtuple
+
+PROTOCOL_VERSION = 1
+PACKET_SIZE = 32
+REQ_PAYLOAD = PACKET_SIZE - 2
+RES_PAYLOAD = PACKET_SIZE - 3
+
+OP_HELLO = 0x00
+OP_TEXT_WRITE = 0x01
+OP_TEXT_CLEAR = 0x02
+OP_CURSOR_SET = 0x03
+OP_STATS_GET = 0x04
+OP_USAGE_GET = 0x05
+OP_HOLDTAP_GET = 0x06
+OP_MISFIRE_GET = 0x07
+OP_BATCH_GET = 0x08
+
+STATUS_OK = 0
+STATUS_UNKNOWN_OP = 1
+STATUS_BAD_ARGS = 2
+STATUS_SPLIT_ERROR = 3
+
+STATS_RESET = 1 << 0
+STATS_NO_LOOP_TIMES = 1 << 0
+USAGE_RESET = 1 << 0
+HOLDTAP_RESET = 1 << 0
+MISFIRE_RESET = 1 << 0
+BATCH_RESET = 1 << 0
+
+# Longest text run per TEXT_WRITE, one byte of the payload is the length
+TEXT_WRITE_MAX = 29
+
+# QMK raw HID usage page and usage, as found at the start of the report descriptor
+RAW_HID_DESCRIPTOR_PREFIX = bytes([0x06, 0x60, 0xFF, 0x09, 0x61])
+
+Response = namedtuple('Response', 'opcode seq status payload')
+Hello = namedtuple('Hello', 'version packet_size cols rows opcodes')
+# latency and latency_max_us are empty when loop_times is False (no us timer)
+Stats = namedtuple('Stats', 'scan_rate latency_max_us split_ok split_fail latency oled_stall_max_us loop_times')
+Usage = namedtuple('Usage', 'flushes keys layers')
+# hist is indexed by HOLDTAP_KINDS, each a list of HOLDTAP_BUCKETS counts
+HoldTap = namedtuple('HoldTap', 'index keycode hist')
+Batch = namedtuple('Batch', 'submitted sent presses')
+
+# usage_t in users/kajih/usage.h
+USAGE_MAGIC = 0x5542
+USAGE_KEYS = 50
+USAGE_LAYERS = 16
+
+# holdtap_stats.h
+HOLDTAP_KINDS = ('tap', 'tap interrupted', 'hold', 'hold interrupted')
+HOLDTAP_BUCKETS = 8
+HOLDTAP_BUCKET_SHIFT = 4
+
+# misfire.h, in enum misfire_rule order
+MISFIRE_RULES = ('hold', 'tap dance')
+
+
+class ProtocolError(Exception):
+    pass
+
+
+def encode(opcode, seq, payload=b''):
+    if len(payload) > REQ_PAYLOAD:
+        raise ValueError('payload too long: %d bytes' % len(payload))
+    return bytes([opcode, seq & 0xFF]) + bytes(payload).ljust(REQ_PAYLOAD, b'\0')
+
+
+def decode(packet):
+    if len(packet) < 3:
+        raise ProtocolError('short response: %d bytes' % len(packet))
+    return Response(packet[0], packet[1], packet[2], bytes(packet[3:]))
+
+
+class HidrawTransport:
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR)
+
+    def send(self, packet):
+        # Leading zero is the report number, QMK raw HID does not use report ids
+        os.write(self.fd, b'\0' + packet)
+
+    def recv(self, timeout):
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return None
+        return os.read(self.fd, PACKET_SIZE)
+
+    def close(self):
+        os.close(self.fd)
+
+
+def find_hidraw():
+    """First hidraw node whose report descriptor is the QMK raw HID interface."""
+    for node in sorted(glob.glob('/sys/class/hidraw/hidraw*')):
+        try:
+            with open(os.path.join(node, 'device', 'report_descriptor'), 'rb') as f:
+                if f.read(len(RAW_HID_DESCRIPTOR_PREFIX)) == RAW_HID_DESCRIPTOR_PREFIX:
+                    return '/dev/' + os.path.basename(node)
+        except OSError:
+            continue
+    return None
+
+
+class Client:
+    def __init__(self, transport, timeout=0.5):
+        self.transport = transport
+        self.timeout = timeout
+        self.seq = 0
+
+    def request(self, opcode, payload=b''):
+        self.seq = (self.seq + 1) & 0xFF
+        self.transport.send(encode(opcode, self.seq, payload))
+        while True:
+            packet = self.transport.recv(self.timeout)
+            if packet is None:
+                raise ProtocolError('no ack for opcode %d seq %d' % (opcode, self.seq))
+            res = decode(packet)
+            # Stale acks from an earlier timed out request are dropped
+            if res.opcode == opcode and res.seq == self.seq:
+                return res
+
+    def checked(self, opcode, payload=b''):
+        res = self.request(opcode, payload)
+        if res.status != STATUS_OK:
+            raise ProtocolError('opcode %d failed with status %d' % (opcode, res.status))
+        return res
+
+    def hello(self):
+        p = self.checked(OP_HELLO).payload
+        hello = Hello(*p[:5])
+        if hello.version != PROTOCOL_VERSION:
+            raise ProtocolError('firmware speaks protocol %d, expected %d' % (hello.version, PROTOCOL_VERSION))
+        return hello
+
+    def text_write(self, text):
+        data = text.encode('latin-1') if isinstance(text, str) else bytes(text)
+        if len(data) > TEXT_WRITE_MAX:
+            raise ValueError('text run too long: %d bytes' % len(data))
+        return self.checked(OP_TEXT_WRITE, bytes([len(data)]) + data)
+
+    def text_clear(self):
+        return self.checked(OP_TEXT_CLEAR)
+
+    def cursor_set(self, col, row):
+        return self.checked(OP_CURSOR_SET, bytes([col, row]))
+
+    def stats(self, reset=False):
+        p = self.checked(OP_STATS_GET, bytes([STATS_RESET if reset else 0])).payload
+        scan_rate, latency_max, ok, fail = struct.unpack_from('<IHHH', p, 0)
+        return Stats(scan_rate, latency_max, ok, fail, list(struct.unpack_from('<8H', p, 10)),
+                     struct.unpack_from('<H', p, 26)[0], not p[28] & STATS_NO_LOOP_TIMES)
+
+    def usage(self, reset=False):
+        """Pages through the usage_t dump, reset clears the counters after the last page."""
+        data = bytearray()
+        total = None
+        while total is None or len(data) < total:
+            last = total is not None and total - len(data) <= RES_PAYLOAD - 3
+            flags = USAGE_RESET if reset and last else 0
+            p = self.checked(OP_USAGE_GET, struct.pack('<HB', len(data), flags)).payload
+            total, length = struct.unpack_from('<HB', p, 0)
+            if length == 0:
+                break
+            data += p[3:3 + length]
+        magic, flushes = struct.unpack_from('<HH', data, 0)
+        if magic != USAGE_MAGIC or len(data) != 4 + 4 * (USAGE_KEYS + USAGE_LAYERS):
+            raise ProtocolError('unexpected usage block: magic %#x, %d bytes' % (magic, len(data)))
+        counters = struct.unpack_from('<%dI' % (USAGE_KEYS + USAGE_LAYERS), data, 4)
+        return Usage(flushes, list(counters[:USAGE_KEYS]), list(counters[USAGE_KEYS:]))
+
+    def holdtap(self, reset=False):
+        """All hold-tap histograms, reset clears them after the last one is read."""
+        keys = []
+        slot, used = 0, None
+        while used is None or slot < used:
+            for kind in range(len(HOLDTAP_KINDS)):
+                last = used is not None and slot == used - 1 and kind == len(HOLDTAP_KINDS) - 1
+                p = self.checked(OP_HOLDTAP_GET, bytes([slot, kind, HOLDTAP_RESET if reset and last else 0])).payload
+                used = p[0]
+                if not used:
+                    return keys
+                if kind == 0:
+                    keys.append(HoldTap(p[1], struct.unpack_from('<H', p, 2)[0], []))
+                keys[-1].hist.append(list(struct.unpack_from('<%dH' % HOLDTAP_BUCKETS, p, 4)))
+            slot += 1
+        return keys
+
+    def misfire(self, reset=False):
+        """Misfire counters per rule name, each a list indexed by LAYOUT index."""
+        page = (RES_PAYLOAD - 3) // 2
+        out = {}
+        for rule, name in enumerate(MISFIRE_RULES):
+            counts, keys = [], None
+            while keys is None or len(counts) < keys:
+                last = rule == len(MISFIRE_RULES) - 1 and keys is not None and keys - len(counts) <= page
+                p = self.checked(OP_MISFIRE_GET, bytes([rule, len(counts), MISFIRE_RESET if reset and last else 0])).payload
+                keys = p[1]
+                n = min(page, keys - len(counts))
+                counts += struct.unpack_from('<%dH' % n, p, 3)
+            out[name] = counts
+        return out
+
+    def batch(self, reset=False):
+        """Keyboard reports submitted and sent by report_batch.c, and the presses in them."""
+        p = self.checked(OP_BATCH_GET, bytes([BATCH_RESET if reset else 0])).payload
+        return Batch(*struct.unpack_from('<3I', p, 0))
+
+
+def open_client(device=None, timeout=0.5):
+    path = device or find_hidraw()
+    if path is None:
+        raise ProtocolError('no QMK raw HID device found, pass --device')
+    return Client(HidrawTransport(path), timeout)
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Compare the keymaps by replaying a text corpus against them.
+
+Every keymap is read from its keymap.c (see keymap_model.py) and each of its
+base layers is scored separately: key presses per character, layer switches,
+same finger bigrams and hand alternation, all on a Swedish host layout.
+The corpus is split into chunks whose character and bigram counts are taken
+on all cores, then every layout is scored from the counts in parallel.
+
+    keycost.py corpus.txt                    kajih, callum and miryo
+    keycost.py -k kajih -k miryo *.md        selected keymaps
+    keycost.py --keymap-file my/keymap.c -   a variant, corpus from stdin
+"""
+import argparse
+import multiprocessing
+import os
+import sys
+from collections import Counter
+
+import keymap_model as km
+
+CHUNK = 1 << 16
+DEFAULT_KEYMAPS = ['kajih', 'callum', 'miryo']
+
+
+def count(text):
+    """Character and bigram counts of one chunk of corpus."""
+    return Counter(text), Counter(zip(text, text[1:]))
+
+
+def _fingers(presses):
+    """(hand, finger, index) of the presses made with fingers, thumbs left out."""
+    out = []
+    for press in presses:
+        hand, finger, _ = km.GEOMETRY[press.index]
+        if finger != 4:
+            out.append((hand, finger, press.index))
+    return out
+
+
+def _link(c, last, cur, n):
+    c['pairs'] += n
+    if last[0] != cur[0]:
+        c['alternations'] += n
+    elif last[1] == cur[1] and last[2] != cur[2]:
+        c['sfb'] += n
+
+
+def score(job):
+    """Counters for one layout from the corpus character and bigram counts."""
+    plans, chars, bigrams = job
+    fingers = {ch: _fingers(plan.presses) for ch, plan in plans.items()}
+    c = Counter()
+    for ch, n in chars.items():
+        plan = plans.get(ch)
+        if plan is None:
+            c['missing'] += n
+            c['missing:' + ch] += n
+            continue
+        c['chars'] += n
+        c['presses'] += len(plan.presses) * n
+        c['effort'] += sum(km.EFFORT[p.index] for p in plan.presses) * n
+        for last, cur in zip(fingers[ch], fingers[ch][1:]):
+            _link(c, last, cur, n)
+    # Transitions between characters: layer changes and the finger hand-over
+    for (a, b), n in bigrams.items():
+        if a not in plans or b not in plans:
+            continue
+        if plans[a].layers != plans[b].layers:
+            c['layer_switches'] += n
+        if fingers[a] and fingers[b]:
+            _link(c, fingers[a][-1], fingers[b][0], n)
+    return c
+
+
+def chunks(files):
+    for path in files:
+        f = sys.stdin if path == '-' else open(path, encoding='utf-8', errors='replace')
+        with f:
+            while True:
+                block = f.read(CHUNK)
+                if not block:
+                    break
+                yield block
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('corpus', nargs='+', help="text files, '-' for stdin")
+    parser.add_argument('-k', '--keymap', action='append', help='rev3 keymap name, repeatable')
+    parser.add_argument('--keymap-file', action='append', default=[], help='path to any keymap.c, repeatable')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(), help='worker processes')
+    parser.add_argument('--missing', type=int, default=5, help='untypeable characters to list per layout')
+    args = parser.parse_args()
+
+    paths = km.keymap_paths(km.repo_root(), args.keymap or ([] if args.keymap_file else DEFAULT_KEYMAPS))
+    labels, tables = [], []
+    for path in paths + args.keymap_file:
+        keymap = km.Keymap(path)
+        for base in keymap.bases:
+            labels.append('%s/%s' % (keymap.name, keymap.layer_names.get(base, base)))
+            tables.append(keymap.plans(base))
+
+    chars, bigrams = Counter(), Counter()
+    with multiprocessing.Pool(args.jobs) as pool:
+        for c, b in pool.imap_unordered(count, chunks(args.corpus), chunksize=4):
+            chars.update(c)
+            bigrams.update(b)
+        totals = pool.map(score, [(plans, chars, bigrams) for plans in tables])
+
+    width = max(len(label) for label in labels)
+    print('%-*s %9s %7s %7s %7s %7s %8s' % (width, 'layout', 'chars', 'kpc', 'layer%', 'sfb%', 'alt%', 'effort'))
+    for label, t in zip(labels, totals):
+        chars = t['chars'] or 1
+        pairs = t['pairs'] or 1
+        print('%-*s %9d %7.3f %7.2f %7.2f %7.2f %8.3f' % (
+            width, label, t['chars'], t['presses'] / chars, 100.0 * t['layer_switches'] / chars,
+            100.0 * t['sfb'] / pairs, 100.0 * t['alternations'] / pairs, t['effort'] / chars))
+        if t['missing'] and args.missing:
+            worst = sorted(((n, k[8:]) for k, n in t.items() if k.startswith('missing:')), reverse=True)
+            print('%*s missing %d: %s' % (width, '', t['missing'],
+                                         ' '.join('%r x%d' % (ch, n) for n, ch in worst[:args.missing])))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,384 @@
+"""Model of the userspace keymaps for the host side layout tools.
+
+Reads the `keymaps` arrays straight from a keymap.c, expanding the keymap's
+own #define aliases, and works out which key presses produce each character
+on a Swedish host layout. Shared by keycost.py and layout_opt.py.
+
+Understood: plain KC_ and SE_ keycodes, S()/LSFT()/ALGR()/RALT() wrappers,
+MT()/LT() taps, MO()/LT() layer holds, OSL()/OSLAYER() one-shot layers (tapped
+before the key, the same one press as a hold), update_tri_layer_state() tri
+layers, ACTION_TAP_DANCE_FN() dances that tap_code16() one key per count,
+OSM()/OS_, OSMOD()/OSM_ and MT() shift keys, and custom keycodes handled by
+shift_and_tap16().
+Anything else is treated as producing no text.
+"""
+import os
+import re
+from collections import namedtuple
+
+KEYS = 50
+
+# LAYOUT() index -> (hand, finger, row), see users/kajih/geometry.h.
+# Fingers: 0 pinky, 1 ring, 2 middle, 3 index, 4 thumb.
+_OUTER = [0, 0, 1, 2, 3, 3]
+
+
+def _geometry():
+    geo = [None] * KEYS
+    for row, base in enumerate((0, 12)):
+        for c in range(6):
+            geo[base + c] = ('L', _OUTER[c], row)
+            geo[base + 6 + c] = ('R', _OUTER[5 - c], row)
+    for c in range(6):
+        geo[24 + c] = ('L', _OUTER[c], 2)
+        geo[34 + c] = ('R', _OUTER[5 - c], 2)
+    for i in (30, 31):
+        geo[i] = ('L', 3, 2)
+    for i in (32, 33):
+        geo[i] = ('R', 3, 2)
+    for i in range(40, 45):
+        geo[i] = ('L', 4, 3)
+    for i in range(45, 50):
+        geo[i] = ('R', 4, 3)
+    return geo
+
+
+GEOMETRY = _geometry()
+
+# Relative effort per position, home row index/middle cheapest
+EFFORT = [
+    4.0, 3.0, 2.4, 2.0, 2.2, 3.0, 3.0, 2.2, 2.0, 2.4, 3.0, 4.0,
+    2.0, 1.5, 1.2, 1.0, 1.0, 2.0, 2.0, 1.0, 1.0, 1.2, 1.5, 2.0,
+    3.0, 3.0, 2.6, 2.2, 2.0, 2.6, 3.5, 4.0, 4.0, 3.5, 2.6, 2.0, 2.2, 2.6, 3.0, 3.0,
+    3.0, 2.5, 1.5, 1.0, 1.2, 1.2, 1.0, 1.5, 2.5, 3.0,
+]
+
+# Swedish host layout: base keycode -> (plain, shifted, altgr)
+_SWEDISH = {
+    'KC_GRV': ('§', '½', None),
+    'KC_1': ('1', '!', None), 'KC_2': ('2', '"', '@'), 'KC_3': ('3', '#', '£'),
+    'KC_4': ('4', '¤', '$'), 'KC_5': ('5', '%', '€'), 'KC_6': ('6', '&', None),
+    'KC_7': ('7', '/', '{'), 'KC_8': ('8', '(', '['), 'KC_9': ('9', ')', ']'),
+    'KC_0': ('0', '=', '}'),
+    'KC_MINS': ('+', '?', '\\'), 'KC_EQL': ('´', '`', None),
+    'KC_LBRC': ('å', 'Å', None), 'KC_RBRC': ('¨', '^', '~'),
+    'KC_SCLN': ('ö', 'Ö', None), 'KC_QUOT': ('ä', 'Ä', None),
+    'KC_NUHS': ("'", '*', None), 'KC_BSLS': ("'", '*', None),
+    'KC_NUBS': ('<', '>', '|'),
+    'KC_COMM': (',', ';', None), 'KC_DOT': ('.', ':', None), 'KC_SLSH': ('-', '_', None),
+    'KC_SPC': (' ', None, None), 'KC_ENT': ('\n', None, None), 'KC_TAB': ('\t', None, None),
+}
+for _c in 'abcdefghijklmnopqrstuvwxyz':
+    _SWEDISH['KC_' + _c.upper()] = (_c, _c.upper(), 'µ' if _c == 'm' else None)
+
+# Dead keys on the Swedish layout, a space follows to get the character itself
+DEAD = set('´`¨^~')
+
+_KC_ALIASES = {
+    'KC_SPACE': 'KC_SPC', 'KC_ENTER': 'KC_ENT', 'KC_MINUS': 'KC_MINS', 'KC_EQUAL': 'KC_EQL',
+    'KC_LEFT_BRACKET': 'KC_LBRC', 'KC_RIGHT_BRACKET': 'KC_RBRC', 'KC_BACKSLASH': 'KC_BSLS',
+    'KC_SEMICOLON': 'KC_SCLN', 'KC_QUOTE': 'KC_QUOT', 'KC_GRAVE': 'KC_GRV', 'KC_COMMA': 'KC_COMM',
+    'KC_SLASH': 'KC_SLSH', 'KC_NONUS_HASH': 'KC_NUHS', 'KC_NONUS_BACKSLASH': 'KC_NUBS',
+}
+
+# keymap_swedish.h, keys the host shifts itself
+_SE_BASE = {
+    'SE_SECT': 'KC_GRV', 'SE_PLUS': 'KC_MINS', 'SE_ACUT': 'KC_EQL', 'SE_ARNG': 'KC_LBRC',
+    'SE_DIAE': 'KC_RBRC', 'SE_ODIA': 'KC_SCLN', 'SE_ADIA': 'KC_QUOT', 'SE_QUOT': 'KC_NUHS',
+    'SE_LABK': 'KC_NUBS', 'SE_COMM': 'KC_COMM', 'SE_DOT': 'KC_DOT', 'SE_MINS': 'KC_SLSH',
+}
+for _c in '0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ':
+    _SE_BASE['SE_' + _c] = 'KC_' + _c
+
+# keymap_swedish.h, keys with the modifier built in
+_SE_FIXED = {
+    'SE_HALF': '½', 'SE_EXLM': '!', 'SE_DQUO': '"', 'SE_HASH': '#', 'SE_CURR': '¤',
+    'SE_PERC': '%', 'SE_AMPR': '&', 'SE_SLSH': '/', 'SE_LPRN': '(', 'SE_RPRN': ')',
+    'SE_EQL': '=', 'SE_QUES': '?', 'SE_GRV': '`', 'SE_CIRC': '^', 'SE_ASTR': '*',
+    'SE_RABK': '>', 'SE_SCLN': ';', 'SE_COLN': ':', 'SE_UNDS': '_', 'SE_AT': '@',
+    'SE_PND': '£', 'SE_DLR': '$', 'SE_EURO': '€', 'SE_LCBR': '{', 'SE_LBRC': '[',
+    'SE_RBRC': ']', 'SE_RCBR': '}', 'SE_BSLS': '\\', 'SE_TILD': '~', 'SE_PIPE': '|',
+    'SE_MICR': 'µ',
+}
+
+_SHIFT_MODS = {'MOD_LSFT', 'MOD_RSFT'}
+_SHIFT_KEYS = {'KC_LSFT', 'KC_RSFT', 'KC_LEFT_SHIFT', 'KC_RIGHT_SHIFT', 'OS_LSFT', 'OS_RSFT', 'OSM_LSFT', 'OSM_RSFT'}
+_TRANSPARENT = {'_______', 'KC_TRNS', 'KC_TRANSPARENT'}
+
+# One key press: LAYOUT index and the layer it is read from
+Press = namedtuple('Press', 'index layer')
+# How a character is typed: every press in order, plus the layers held for it
+Plan = namedtuple('Plan', 'presses layers')
+
+
+class Call:
+    """Parsed keycode expression, NAME or NAME(args...)."""
+
+    def __init__(self, name, args=None):
+        self.name = name
+        self.args = args
+
+    def __repr__(self):
+        return self.name if self.args is None else '%s(%s)' % (self.name, ', '.join(map(repr, self.args)))
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def _split_args(text):
+    args, depth, start = [], 0, 0
+    for i, ch in enumerate(text):
+        if ch == '(':
+            depth += 1
+        elif ch == ')':
+            depth -= 1
+        elif ch == ',' and depth == 0:
+            args.append(text[start:i].strip())
+            start = i + 1
+    tail = text[start:].strip()
+    if tail:
+        args.append(tail)
+    return args
+
+
+def _balanced(text, open_at):
+    """Text between the parenthesis at open_at and its match."""
+    depth = 0
+    for i in range(open_at, len(text)):
+        if text[i] == '(':
+            depth += 1
+        elif text[i] == ')':
+            depth -= 1
+            if depth == 0:
+                return text[open_at + 1:i]
+    raise ValueError('unbalanced parentheses')
+
+
+class Keymap:
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.basename(os.path.dirname(os.path.abspath(path)))
+        with open(path, encoding='utf-8') as f:
+            raw = f.read()
+        text = strip_comments(raw)
+        self.defines = {}
+        self.macros = {}
+        for m in re.finditer(r'^[ \t]*#define[ \t]+(\w+)(\(([^)]*)\))?[ \t]+(.+)$', text, flags=re.M):
+            name, params, body = m.group(1), m.group(3), m.group(4).strip()
+            if m.group(2):
+                self.macros[name] = ([p.strip() for p in params.split(',')], body)
+            else:
+                self.defines[name] = body
+        self.layer_index = self._enum(text, 'layers')
+        self.layer_names = {v: k for k, v in self.layer_index.items()}
+        self.layers = self._layers(text)
+        self.tri = [tuple(self.layer_index.get(a.strip(), -1) for a in m.groups())
+                    for m in re.finditer(r'update_tri_layer_state\(\s*\w+\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\)', text)]
+        self.dances = self._dances(text)
+        self.custom = {m.group(1): (m.group(3), m.group(2)) for m in re.finditer(
+            r'case\s+(\w+)\s*:[^;]*?shift_and_tap16\(\s*record\s*,\s*(\w+)\s*,\s*(\w+)\s*\)', text)}
+        self.bases = sorted({self.layer_index[c.args[0].name] for c in self._all_calls()
+                             if c.name == 'DF' and c.args[0].name in self.layer_index}) or [0]
+
+    @staticmethod
+    def _enum(text, name):
+        m = re.search(r'enum\s+%s\s*\{([^}]*)\}' % name, text)
+        values, nxt = {}, 0
+        for item in (m.group(1).split(',') if m else []):
+            item = item.strip()
+            if not item:
+                continue
+            if '=' in item:
+                item, value = [s.strip() for s in item.split('=')]
+                nxt = int(value, 0)
+            values[item] = nxt
+            nxt += 1
+        return values
+
+    def _layers(self, text):
+        start = text.index('keymaps[]')
+        body = text[text.index('{', start):text.index('};', start)]
+        layers = {}
+        self.source = {}
+        for m in re.finditer(r'\[\s*(\w+)\s*\]\s*=\s*LAYOUT\w*\s*\(', body):
+            args = _split_args(_balanced(body, m.end() - 1))
+            if len(args) != KEYS:
+                raise ValueError('%s: layer %s has %d keys, expected %d' % (self.path, m.group(1), len(args), KEYS))
+            index = self.layer_index.get(m.group(1))
+            if index is None:
+                index = int(m.group(1), 0)
+            layers[index] = [self.parse(a) for a in args]
+            # Key text as written, for printing the layer back out
+            self.source[index] = [' '.join(a.split()) for a in args]
+        return layers
+
+    def _dances(self, text):
+        funcs = {}
+        for m in re.finditer(r'void\s+(\w+)\s*\(\s*tap_dance_state_t[^)]*\)\s*\{', text):
+            body = text[m.end():text.find('\n}', m.end())]
+            taps = {}
+            for c in re.finditer(r'(case\s+(\d+)|default)\s*:\s*tap_code16\(\s*(\w+)\s*\)', body):
+                taps[int(c.group(2)) if c.group(2) else None] = c.group(3)
+            if None in taps:
+                taps[max([k for k in taps if k is not None] or [0]) + 1] = taps.pop(None)
+            funcs[m.group(1)] = taps
+        dances = {}
+        for m in re.finditer(r'\[\s*(\w+)\s*\]\s*=\s*ACTION_TAP_DANCE_FN\(\s*(\w+)\s*\)', text):
+            dances[m.group(1)] = funcs.get(m.group(2), {})
+        return dances
+
+    def _all_calls(self):
+        stack = [c for layer in self.layers.values() for c in layer]
+        while stack:
+            c = stack.pop()
+            yield c
+            stack.extend(c.args or [])
+
+    def parse(self, text, depth=0):
+        text = text.strip()
+        if depth > 32:
+            raise ValueError('macro recursion in %r' % text)
+        m = re.match(r'^(\w+)\s*(\()?', text)
+        if not m:
+            return Call(text)
+        name = m.group(1)
+        if m.group(2):
+            args = _split_args(_balanced(text, m.end() - 1))
+            if name in self.macros:
+                params, body = self.macros[name]
+                for p, a in zip(params, args):
+                    body = re.sub(r'\b%s\b' % re.escape(p), a, body)
+                return self.parse(body, depth + 1)
+            return Call(name, [self.parse(a, depth + 1) for a in args])
+        if name in self.defines:
+            return self.parse(self.defines[name], depth + 1)
+        return Call(name)
+
+    # What pressing a key does --------------------------------------------
+
+    def layer_hold(self, call):
+        """Layer held by the key, or turned on for the next key by OSL()/OSLAYER(), or None."""
+        if call.name in ('MO', 'LT', 'OSL', 'OSLAYER') and call.args:
+            return self.layer_index.get(call.args[0].name)
+        return None
+
+    def is_shift(self, call):
+        if call.name in _SHIFT_KEYS:
+            return True
+        if call.name in ('MT', 'OSM', 'OSMOD') and call.args:
+            return call.args[0].name in _SHIFT_MODS
+        return False
+
+    def outputs(self, call):
+        """(character, needs host shift, taps) for everything the key can type."""
+        if call.name in ('MT', 'LT') and call.args and len(call.args) == 2:
+            return self.outputs(call.args[1])
+        if call.name == 'TD' and call.args:
+            return [(ch, sh, taps) for taps, kc in sorted(self.dances.get(call.args[0].name, {}).items())
+                    for ch, sh, _ in self.outputs(self.parse(kc))]
+        if call.name in self.custom:
+            plain, shifted = self.custom[call.name]
+            out = [(ch, False, 1) for ch, sh, _ in self.outputs(self.parse(plain)) if not sh]
+            out += [(ch, True, 1) for ch, sh, _ in self.outputs(self.parse(shifted)) if not sh]
+            return out
+        if call.name in ('S', 'LSFT', 'RSFT', 'ALGR', 'RALT') and call.args:
+            base = self._base(call.args[0].name)
+            chars = _SWEDISH.get(base)
+            if not chars:
+                return []
+            ch = chars[1] if call.name in ('S', 'LSFT', 'RSFT') else chars[2]
+            return [(ch, False, 1)] if ch else []
+        if call.args is not None:
+            return []
+        if call.name in _SE_FIXED:
+            return [(_SE_FIXED[call.name], False, 1)]
+        base = self._base(call.name)
+        chars = _SWEDISH.get(base)
+        if not chars:
+            return []
+        out = [(chars[0], False, 1)]
+        if chars[1]:
+            out.append((chars[1], True, 1))
+        return out
+
+    @staticmethod
+    def _base(name):
+        name = _KC_ALIASES.get(name, name)
+        return _SE_BASE.get(name, name)
+
+    # Layer stacks ---------------------------------------------------------
+
+    def effective(self, active):
+        """Keys seen with the given layers active, transparency resolved."""
+        order = sorted(active, reverse=True)
+        keys = []
+        for i in range(KEYS):
+            for layer in order + [0]:
+                call = self.layers.get(layer, [None] * KEYS)[i]
+                if call is not None and call.name not in _TRANSPARENT:
+                    keys.append((call, layer))
+                    break
+            else:
+                keys.append((Call('KC_NO'), 0))
+        return keys
+
+    def states(self, base):
+        """Reachable layer stacks from a base layer: (held layers, presses to hold them)."""
+        base_keys = self.effective({base})
+        holds = {}
+        for i, (call, layer) in enumerate(base_keys):
+            target = self.layer_hold(call)
+            if target is not None and target not in holds:
+                holds[target] = Press(i, layer)
+        states = [((), [])]
+        for target, press in sorted(holds.items()):
+            states.append(((target,), [press]))
+        for a, b, c in self.tri:
+            if a in holds and b in holds:
+                states.append(((a, b, c), [holds[a], holds[b]]))
+        return states
+
+    def plans(self, base):
+        """Cheapest Plan for every character typeable from this base layer."""
+        states = self.states(base)
+        best = {}
+        shifts = []
+        for held, presses in states:
+            active = {base} | set(held)
+            for i, (call, layer) in enumerate(self.effective(active)):
+                if self.is_shift(call):
+                    shifts.append(presses + [Press(i, layer)])
+                for ch, needs_shift, taps in self.outputs(call):
+                    plan = Plan(presses + [Press(i, layer)] * taps, held)
+                    best.setdefault(ch, [])
+                    best[ch].append((plan, needs_shift))
+
+        plans = {}
+        for ch, options in best.items():
+            candidates = []
+            for plan, needs_shift in options:
+                if needs_shift:
+                    if not shifts:
+                        continue
+                    hand = GEOMETRY[plan.presses[-1].index][0]
+                    # Cheapest shift, on the other hand when there is a choice
+                    shift = min(shifts, key=lambda s: (len(s), GEOMETRY[s[-1].index][0] == hand))
+                    plan = Plan(shift + plan.presses, plan.layers)
+                candidates.append(plan)
+            if candidates:
+                plans[ch] = min(candidates, key=lambda p: (len(p.presses), len(p.layers)))
+
+        if ' ' in plans:
+            for ch in DEAD & set(plans):
+                plans[ch] = Plan(plans[ch].presses + plans[' '].presses, plans[ch].layers)
+        return plans
+
+
+def keymap_paths(root, names):
+    return [os.path.join(root, 'keyboards', 'splitkb', 'kyria', 'rev3', 'keymaps', n, 'keymap.c') for n in names]
+
+
+def repo_root():
+    return os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..', '..'))
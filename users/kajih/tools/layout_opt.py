@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""Propose key swaps within the symbol, navigation and function layers.
+
+Each layer is optimised on its own by simulated annealing over swaps of its
+movable keys. Several chains with different seeds run in parallel processes
+and the best result is printed as a LAYOUT() block ready to paste over the
+layer in keymap.c.
+
+The cost of a layer is the position effort of every key, weighted by how often
+the key is used from that layer, plus a penalty for same finger bigrams
+between keys of the layer. Weights for keys that type text come from the
+corpus. Keys without text (arrows, F keys) use --weights, a JSON object of
+keycode text to count, else the keyboard's usage counters (usage_report.py
+--json): the presses recorded at the key's position times the layer's share
+of all presses, else weight 1.
+
+Pinned and never moved: transparent and empty keys, modifiers, mod-taps and
+layer keys, QK_ keycodes, plus anything given with --pin (keycode text or
+LAYOUT index).
+
+    layout_opt.py -k kajih corpus.txt
+    layout_opt.py -k miryo --layer _SYM --pin SE_LPRN --pin 20 corpus.txt
+    layout_opt.py -k kajih --usage usage.json --weights nav.json corpus.txt
+"""
+import argparse
+import json
+import math
+import multiprocessing
+import os
+import random
+import sys
+from collections import Counter
+
+import keycost
+import keymap_model as km
+
+DEFAULT_LAYERS = ['_SYM', '_NAV', '_FUNCTION', '_FUN']
+SFB_PENALTY = 2.0
+# Every moved key costs this share of an average key, so ties keep the current layout
+MOVE_PENALTY = 0.02
+
+# Keys that change mods or layers, matched on the parsed keycode so aliases count
+_PINNED_CALLS = {'MO', 'LT', 'TG', 'TO', 'DF', 'PDF', 'TT', 'LM', 'OSL', 'OSM', 'OSLAYER', 'OSMOD', 'MT',
+                 'LCTL_T', 'LSFT_T', 'LALT_T', 'LGUI_T', 'RCTL_T', 'RSFT_T', 'RALT_T', 'RGUI_T'}
+_PINNED_KEYS = {
+    'KC_LCTL', 'KC_LSFT', 'KC_LALT', 'KC_LGUI', 'KC_RCTL', 'KC_RSFT', 'KC_RALT', 'KC_RGUI',
+    'KC_LEFT_CTRL', 'KC_LEFT_SHIFT', 'KC_LEFT_ALT', 'KC_LEFT_GUI',
+    'KC_RIGHT_CTRL', 'KC_RIGHT_SHIFT', 'KC_RIGHT_ALT', 'KC_RIGHT_GUI', 'KC_ALGR', 'KC_LCMD', 'KC_RCMD',
+    'OS_LCTL', 'OS_LSFT', 'OS_LALT', 'OS_LGUI', 'OS_RCTL', 'OS_RSFT', 'OS_RALT', 'OS_RGUI',
+    'OSM_LCTL', 'OSM_LSFT', 'OSM_LALT', 'OSM_LGUI', 'OSM_RCTL', 'OSM_RSFT', 'OSM_RALT', 'OSM_RGUI',
+}
+_EMPTY = {'_______', 'KC_TRNS', 'KC_TRANSPARENT', 'XXXXXXX', 'KC_NO'}
+
+
+def pinned(call):
+    if call.name in _PINNED_KEYS or call.name.startswith('QK_'):
+        return True
+    return call.args is not None and call.name in _PINNED_CALLS
+
+
+class Problem:
+    """One layer: movable keys, their weights and the bigram penalties between them."""
+
+    def __init__(self, keymap, layer, base, chars, bigrams, usage, weights, pins):
+        self.layer = layer
+        self.source = list(keymap.source[layer])
+        calls = keymap.layers[layer]
+
+        self.positions = []
+        for i, (text, call) in enumerate(zip(self.source, calls)):
+            if text in _EMPTY or text in pins or str(i) in pins or pinned(call):
+                continue
+            self.positions.append(i)
+
+        # Characters whose cheapest plan ends on this layer count for the key typing them
+        plans = keymap.plans(base)
+        owner = {}
+        for ch, plan in plans.items():
+            last = plan.presses[-1]
+            if last.layer == layer and last.index in self.positions:
+                owner[ch] = last.index
+
+        # Presses at a position are counted whatever the layer, this layer's
+        # share of all presses estimates how many of them it gets
+        recorded = {}
+        if usage and layer < len(usage['layers']):
+            share = usage['layers'][layer] / (sum(usage['layers']) or 1)
+            recorded = {i: usage['keys'][i] * share for i in self.positions if i < len(usage['keys'])}
+
+        self.move_cost = 0.0
+        self.weight = {i: float(weights.get(self.source[i], 0)) for i in self.positions}
+        for ch, i in owner.items():
+            self.weight[i] += chars.get(ch, 0)
+        for i in self.positions:
+            if self.weight[i] == 0:
+                self.weight[i] = recorded.get(i) or 1.0
+
+        pair = Counter()
+        for (a, b), n in bigrams.items():
+            if a in owner and b in owner and owner[a] != owner[b]:
+                pair[tuple(sorted((owner[a], owner[b])))] += n
+        self.pairs = dict(pair)
+        self.neighbours = {i: {} for i in self.positions}
+        for (a, b), n in self.pairs.items():
+            self.neighbours[a][b] = n
+            self.neighbours[b][a] = n
+
+        self.move_cost = MOVE_PENALTY * sum(self.key_cost(i, i) for i in self.positions) / max(1, len(self.positions))
+
+    def key_cost(self, key, pos):
+        return self.weight[key] * km.EFFORT[pos] + (self.move_cost if key != pos else 0.0)
+
+    def pair_cost(self, pos_a, pos_b, n):
+        ga, gb = km.GEOMETRY[pos_a], km.GEOMETRY[pos_b]
+        return SFB_PENALTY * n if ga[0] == gb[0] and ga[1] == gb[1] else 0.0
+
+    def cost(self, place):
+        total = sum(self.key_cost(k, p) for k, p in place.items())
+        total += sum(self.pair_cost(place[a], place[b], n) for (a, b), n in self.pairs.items())
+        return total
+
+    def delta(self, place, a, b):
+        """Cost change of swapping the positions of keys a and b."""
+        pa, pb = place[a], place[b]
+        d = self.key_cost(a, pb) + self.key_cost(b, pa) - self.key_cost(a, pa) - self.key_cost(b, pb)
+        for key, old, new in ((a, pa, pb), (b, pb, pa)):
+            for other, n in self.neighbours[key].items():
+                if other in (a, b):
+                    continue
+                d += self.pair_cost(new, place[other], n) - self.pair_cost(old, place[other], n)
+        return d
+
+
+def anneal(job):
+    problem, seed, steps = job
+    rng = random.Random(seed)
+    keys = list(problem.positions)
+    place = {k: k for k in keys}
+    cost = problem.cost(place)
+    if len(keys) < 2:
+        return cost, place
+
+    best, best_place = cost, dict(place)
+
+    # Start hot enough to accept a typical uphill swap, cool geometrically
+    t0 = max(1e-9, sum(problem.weight.values()) / len(keys))
+    t1 = t0 * 1e-4
+    for step in range(steps):
+        t = t0 * (t1 / t0) ** (step / steps)
+        a, b = rng.sample(keys, 2)
+        d = problem.delta(place, a, b)
+        if d <= 0 or rng.random() < math.exp(-d / t):
+            place[a], place[b] = place[b], place[a]
+            cost += d
+            if cost < best:
+                best, best_place = cost, dict(place)
+    return best, best_place
+
+
+def render(name, source):
+    rows = [source[0:12], source[12:24], source[24:40], source[40:50]]
+    width = min(8, max(len(s) for s in source))
+    lines = ['    [%s] = LAYOUT(' % name]
+    for n, row in enumerate(rows):
+        cells = [s + ',' if (n < 3 or i < len(row) - 1) else s for i, s in enumerate(row)]
+        lines.append('        ' + ' '.join(c.ljust(width + 1) for c in cells).rstrip())
+    lines.append('    ),')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('corpus', nargs='+', help="text files, '-' for stdin")
+    parser.add_argument('-k', '--keymap', default='kajih', help='rev3 keymap name')
+    parser.add_argument('--keymap-file', help='path to any keymap.c instead of --keymap')
+    parser.add_argument('--layer', action='append', help='layer to optimise, repeatable')
+    parser.add_argument('--base', help='base layer the text is typed from, first DF() layer by default')
+    parser.add_argument('--pin', action='append', default=[], help='keycode text or LAYOUT index that stays put')
+    parser.add_argument('--usage', help='usage_report.py --json output')
+    parser.add_argument('--weights', help='JSON object of keycode text to press count')
+    parser.add_argument('--chains', type=int, default=max(4, os.cpu_count() or 1), help='parallel annealing chains')
+    parser.add_argument('--steps', type=int, default=200000, help='swaps tried per chain')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    path = args.keymap_file or km.keymap_paths(km.repo_root(), [args.keymap])[0]
+    keymap = km.Keymap(path)
+    base = keymap.layer_index[args.base] if args.base else keymap.bases[0]
+    usage = json.load(open(args.usage)) if args.usage else None
+    weights = json.load(open(args.weights)) if args.weights else {}
+    names = [n for n in (args.layer or DEFAULT_LAYERS) if n in keymap.layer_index]
+    if not names:
+        parser.error('none of the layers exist in %s' % path)
+
+    chars, bigrams = Counter(), Counter()
+    with multiprocessing.Pool(args.chains) as pool:
+        for c, b in pool.imap_unordered(keycost.count, keycost.chunks(args.corpus), chunksize=4):
+            chars.update(c)
+            bigrams.update(b)
+
+        for name in names:
+            layer = keymap.layer_index[name]
+            problem = Problem(keymap, layer, base, chars, bigrams, usage, weights, set(args.pin))
+            before = problem.cost({k: k for k in problem.positions})
+            jobs = [(problem, args.seed + i, args.steps) for i in range(args.chains)]
+            best, place = min(pool.map(anneal, jobs), key=lambda r: r[0])
+
+            source = list(problem.source)
+            for key, pos in place.items():
+                source[pos] = problem.source[key]
+            moved = sum(1 for k, p in place.items() if k != p)
+            print('// %s: %d movable keys, %d moved, cost %.1f -> %.1f (%.1f%%)' % (
+                name, len(problem.positions), moved, before, best, 100.0 * (best - before) / (before or 1)))
+            if moved:
+                print(render(name, source))
+            print()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
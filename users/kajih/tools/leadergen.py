@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Compile the leader sequences (leader/sequences.txt) into leader_trie.h.
+
+The sequences become a trie stored as a dense PROGMEM table: one row per node
+that has children and one column per key used anywhere in the table, so every
+key press is a fixed number of flash reads whatever the number of sequences.
+Nodes with children are numbered first, so a node past the table is one that
+nothing continues and leader.c can fire it at once.
+
+    leadergen.py                     regenerate leader_trie.h
+    leadergen.py --source my.txt     another sequence table
+    leadergen.py --check             only validate and print the sizes
+"""
+import argparse
+import os
+import shlex
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+USERSPACE = os.path.dirname(HERE)
+
+KEYS = 'abcdefghijklmnopqrstuvwxyz1234567890'  # KC_A .. KC_0 in keycode order
+MAX_NODES = 255
+MAX_ACTIONS = 127
+
+
+class Action:
+    def __init__(self, kind, args):
+        self.kind = kind
+        self.args = args
+
+
+def parse(path):
+    sequences = {}
+    with open(path, encoding='utf-8') as f:
+        for number, line in enumerate(f, 1):
+            words = shlex.split(line, comments=True)
+            if not words:
+                continue
+            where = '%s:%d' % (os.path.basename(path), number)
+            if len(words) < 3 or words[1] not in ('send', 'tap'):
+                sys.exit('leadergen: %s: expected "keys send TEXT" or "keys tap CODE..."' % where)
+            keys, kind, args = words[0], words[1], words[2:]
+            if any(k not in KEYS for k in keys):
+                sys.exit('leadergen: %s: keys must be letters and digits, got %r' % (where, keys))
+            if kind == 'send' and len(args) != 1:
+                sys.exit('leadergen: %s: send takes one quoted text' % where)
+            if keys in sequences:
+                sys.exit('leadergen: %s: %r is defined twice' % (where, keys))
+            sequences[keys] = Action(kind, args)
+    if not sequences:
+        sys.exit('leadergen: no sequences in %s' % path)
+    return sequences
+
+
+def build(sequences):
+    """Node list, branches first: (prefix, children {key: node}, action index or None)."""
+    symbols = sorted({k for keys in sequences for k in keys}, key=KEYS.index)
+    prefixes = {keys[:i] for keys in sequences for i in range(len(keys) + 1)}
+    order = sorted(prefixes, key=lambda p: (not any(q != p and q.startswith(p) for q in prefixes), len(p), p))
+    ids = {p: i for i, p in enumerate(order)}
+    actions = [sequences[keys] for keys in sorted(sequences, key=lambda s: (len(s), s))]
+    index = {keys: i for i, keys in enumerate(sorted(sequences, key=lambda s: (len(s), s)))}
+    nodes = [(p, {k: ids[p + k] for k in symbols if p + k in ids}, index.get(p)) for p in order]
+    if len(nodes) > MAX_NODES or len(actions) > MAX_ACTIONS:
+        sys.exit('leadergen: %d nodes and %d actions, at most %d and %d fit' % (len(nodes), len(actions), MAX_NODES, MAX_ACTIONS))
+    return symbols, nodes, actions
+
+
+def c_string(text):
+    out, escaped = '', False
+    for b in text.encode('utf-8'):
+        c = chr(b)
+        if not 0x20 <= b < 0x7F:
+            out += '\\x%02X' % b
+            escaped = True
+            continue
+        # A hex digit straight after \x would extend the escape
+        if escaped and c in '0123456789abcdefABCDEF':
+            out += '""'
+        out += '\\' + c if c in '"\\' else c
+        escaped = False
+    return '"%s"' % out
+
+
+def write(path, source, symbols, nodes, actions):
+    branches = sum(1 for _, children, _ in nodes if children)
+    lines = ['#pragma once', '',
+             '// Generated by tools/leadergen.py from %s, do not edit.' % source, '',
+             '#define LEADER_SYMBOLS %d' % len(symbols),
+             '#define LEADER_NODES %d' % len(nodes),
+             '#define LEADER_BRANCHES %d // nodes with children, the rest end a sequence' % branches, '',
+             '// Key (KC_A .. KC_0) to trie column, LEADER_NONE if no sequence uses it',
+             'static const uint8_t PROGMEM leader_symbol[%d] = {' % len(KEYS)]
+    column = {k: i for i, k in enumerate(symbols)}
+    cells = ['%s' % column[k] if k in column else 'LEADER_NONE' for k in KEYS]
+    for i in range(0, len(KEYS), 12):
+        lines.append('    ' + ', '.join(cells[i:i + 12]) + ',')
+    lines += ['};', '',
+              '// Next node per branch node and column, 0 where no sequence continues (the root',
+              '// is never a child)',
+              '// clang-format off',
+              'static const uint8_t PROGMEM leader_next[LEADER_BRANCHES * LEADER_SYMBOLS] = {',
+              ' //' + ''.join(k.rjust(4) for k in symbols)]
+    for prefix, children, _ in nodes[:branches]:
+        lines.append('    ' + ''.join(('%d,' % children.get(k, 0)).rjust(4) for k in symbols) + ' // "%s"' % prefix)
+    lines += ['};', '// clang-format on', '',
+              '// Action index + 1 per node, 0 for none',
+              'static const uint8_t PROGMEM leader_action[LEADER_NODES] = {']
+    cells = ['0' if action is None else '%d' % (action + 1) for _, _, action in nodes]
+    for i in range(0, len(cells), 16):
+        lines.append('    ' + ', '.join(cells[i:i + 16]) + ',')
+    lines += ['};', '']
+
+    codes = []
+    for i, action in enumerate(actions):
+        if action.kind == 'send':
+            lines.append('static const char PROGMEM leader_text_%d[] = %s;' % (i, c_string(action.args[0])))
+    lines += ['', 'static const uint16_t PROGMEM leader_codes[] = {']
+    entries = []
+    for i, action in enumerate(actions):
+        if action.kind == 'send':
+            entries.append('{leader_text_%d, 0, 0}' % i)
+        else:
+            entries.append('{NULL, %d, %d}' % (len(codes), len(action.args)))
+            codes += action.args
+    lines += ['    %s,' % c for c in codes] or ['    KC_NO,']
+    lines += ['};', '', 'static const leader_action_t PROGMEM leader_actions[] = {']
+    lines += ['    %s,' % e for e in entries]
+    lines += ['};', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+    return len(codes)
+
+
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source', default=os.path.join(USERSPACE, 'leader', 'sequences.txt'))
+    parser.add_argument('--output', default=os.path.join(USERSPACE, 'leader_trie.h'))
+    parser.add_argument('--check', action='store_true', help='validate and print the sizes only')
+    args = parser.parse_args()
+
+    sequences = parse(args.source)
+    symbols, nodes, actions = build(sequences)
+    codes = sum(len(a.args) for a in actions if a.kind == 'tap')
+    if not args.check:
+        write(args.output, os.path.relpath(args.source, USERSPACE), symbols, nodes, actions)
+
+    text = sum(len(a.args[0].encode('utf-8')) + 1 for a in actions if a.kind == 'send')
+    branches = sum(1 for _, children, _ in nodes if children)
+    table = branches * len(symbols) + len(nodes) + len(KEYS)
+    print('leadergen: %d sequences, %d nodes (%d branches) x %d keys, %d bytes of trie, %d of actions, longest sequence %d' % (
+        len(sequences), len(nodes), branches, len(symbols), table, text + 2 * codes + 5 * len(actions),
+        max(len(keys) for keys in sequences)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""Push system metrics to the off-hand OLED through the raw HID protocol.
+
+Every interval the screen is composed on the host, diffed against what the
+keyboard is known to show, and only the changed runs are sent. Packets are
+paced by a token bucket so the split link is never flooded; anything that
+does not fit the budget is carried over to the next interval.
+
+    offhand_daemon.py                       autodetect the keyboard
+    offhand_daemon.py --build-status FILE   show the first line of FILE
+    offhand_daemon.py --loopback --show     run against uhid_standin's model
+"""
+import argparse
+import os
+import sys
+import time
+
+import kajih_hid as hid
+
+# Gaps shorter than this are rewritten rather than paying for a CURSOR_SET
+MERGE_GAP = 3
+
+
+class CpuMeter:
+    def __init__(self):
+        self.last = self._read()
+
+    @staticmethod
+    def _read():
+        with open('/proc/stat') as f:
+            fields = [int(v) for v in f.readline().split()[1:]]
+        idle = fields[3] + fields[4]
+        return idle, sum(fields)
+
+    def percent(self):
+        idle, total = self._read()
+        d_idle, d_total = idle - self.last[0], total - self.last[1]
+        self.last = (idle, total)
+        return 0 if d_total <= 0 else 100 * (d_total - d_idle) // d_total
+
+
+def build_status(path):
+    if not path:
+        return '-'
+    try:
+        with open(path) as f:
+            return f.readline().strip() or '-'
+    except OSError:
+        return '?'
+
+
+def bar(percent, width):
+    filled = percent * width // 100
+    return '#' * filled + '.' * (width - filled)
+
+
+def compose(cols, rows, cpu, build):
+    now = time.localtime()
+    lines = [
+        time.strftime('%H:%M:%S  %a %d %b', now),
+        'CPU %3d%% %s' % (cpu, bar(cpu, cols - 9)),
+        'Load %.2f %.2f %.2f' % os.getloadavg(),
+        'Build %s' % build,
+    ]
+    lines += [''] * rows
+    return [line[:cols].ljust(cols) for line in lines[:rows]]
+
+
+def diff_runs(shown, wanted):
+    """(row, col, text) runs that differ, nearby runs merged into one write."""
+    runs = []
+    for row, (old, new) in enumerate(zip(shown, wanted)):
+        start = None
+        end = None
+        for col, (a, b) in enumerate(zip(old, new)):
+            if a == b:
+                continue
+            if start is not None and col - end > MERGE_GAP:
+                runs.append((row, start, new[start:end]))
+                start = None
+            if start is None:
+                start = col
+            end = col + 1
+        if start is not None:
+            runs.append((row, start, new[start:end]))
+    return runs
+
+
+class TokenBucket:
+    def __init__(self, rate, burst):
+        self.rate = rate
+        self.burst = burst
+        self.tokens = burst
+        self.stamp = time.monotonic()
+
+    def take(self, count):
+        now = time.monotonic()
+        self.tokens = min(self.burst, self.tokens + (now - self.stamp) * self.rate)
+        self.stamp = now
+        if self.tokens < count:
+            return False
+        self.tokens -= count
+        return True
+
+
+class Display:
+    def __init__(self, client, cols, rows, bucket):
+        self.client = client
+        self.cols = cols
+        self.rows = rows
+        self.bucket = bucket
+        self.shown = [' ' * cols for _ in range(rows)]
+        self.cursor = None
+        self.packets = 0
+
+    def sync(self, wanted):
+        """Send as much of the difference as the budget allows, returns runs left over."""
+        runs = diff_runs(self.shown, wanted)
+        for index, (row, col, text) in enumerate(runs):
+            for offset in range(0, len(text), hid.TEXT_WRITE_MAX):
+                chunk = text[offset:offset + hid.TEXT_WRITE_MAX]
+                pos = (row, col + offset)
+                cost = 1 if self.cursor == pos else 2
+                if not self.bucket.take(cost):
+                    return len(runs) - index
+                try:
+                    if self.cursor != pos:
+                        self.client.cursor_set(pos[1], pos[0])
+                        self.packets += 1
+                    self.client.text_write(chunk)
+                    self.packets += 1
+                except hid.ProtocolError as e:
+                    # Unknown state on the off-hand, position again next time
+                    print('offhand: %s' % e, file=sys.stderr)
+                    self.cursor = None
+                    return len(runs) - index
+                line = self.shown[pos[0]]
+                self.shown[pos[0]] = line[:pos[1]] + chunk + line[pos[1] + len(chunk):]
+                self.cursor = (pos[0], pos[1] + len(chunk))
+        return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--device', help='hidraw node, autodetected by default')
+    parser.add_argument('--interval', type=float, default=1.0, help='seconds between screen updates')
+    parser.add_argument('--max-rate', type=float, default=40.0, help='packets per second sent to the keyboard')
+    parser.add_argument('--burst', type=int, default=12, help='packets that may be sent back to back')
+    parser.add_argument('--build-status', metavar='FILE', help='file whose first line is shown as build status')
+    parser.add_argument('--loopback', action='store_true', help='talk to the in-process stand-in instead of a keyboard')
+    parser.add_argument('--show', action='store_true', help='with --loopback, print the stand-in screen')
+    parser.add_argument('--count', type=int, default=0, help='stop after this many updates')
+    args = parser.parse_args()
+
+    if args.loopback:
+        import uhid_standin
+        model = uhid_standin.FirmwareModel()
+        client = hid.Client(uhid_standin.LoopbackTransport(model))
+    else:
+        client = hid.open_client(args.device)
+
+    hello = client.hello()
+    client.text_clear()
+    display = Display(client, hello.cols, hello.rows, TokenBucket(args.max_rate, args.burst))
+    cpu = CpuMeter()
+
+    updates = 0
+    while not args.count or updates < args.count:
+        left = display.sync(compose(hello.cols, hello.rows, cpu.percent(), build_status(args.build_status)))
+        if left:
+            print('offhand: rate limited, %d runs deferred' % left, file=sys.stderr)
+        if args.loopback and args.show:
+            print('\n'.join('|%s|' % row for row in model.screen()) + '\n')
+        updates += 1
+        time.sleep(args.interval)
+    print('offhand: %d packets for %d updates' % (display.packets, updates), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""Compile the typo list (typo/typos.txt) into typo_trie.h.
+
+Typos are stored reversed in a suffix trie so typo.c can walk it from the last
+key typed backwards. The first step is a dense table indexed by the last key,
+after that a node is one of:
+
+    symbol                  the next older key must be this one
+    TYPO_BRANCH | n         n (symbol, u16 node) pairs sorted by symbol
+    TYPO_MATCH | backspaces followed by the correction, NUL terminated
+
+The sizes printed are what the trie costs in flash, the worst case reads are
+the most flash bytes one key press can read before it matches or gives up.
+
+    typogen.py                       regenerate typo_trie.h
+    typogen.py --source my.txt       another typo list
+    typogen.py --check               only validate and print the sizes
+    typogen.py --words /usr/share/dict/words --words sv.txt
+                                     also reject typos that are real words
+"""
+import argparse
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+USERSPACE = os.path.dirname(HERE)
+
+# Symbol n is SYMBOLS[n - 1], 0 is never a symbol. Must match typo.h.
+SYMBOLS = ":abcdefghijklmnopqrstuvwxyzåäö'"
+BOUNDARY = ':'
+BRANCH = 0x40
+MATCH = 0x80
+NONE = 0xFFFF
+
+
+def symbol(ch):
+    return SYMBOLS.index(ch) + 1
+
+
+def parse(path):
+    typos = {}
+    with open(path, encoding='utf-8') as f:
+        for number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            where = '%s:%d' % (os.path.basename(path), number)
+            if '->' not in line:
+                sys.exit('typogen: %s: expected "typo -> correction"' % where)
+            typo, correction = (s.strip() for s in line.split('->', 1))
+            word = typo.strip(BOUNDARY)
+            if not word or any(ch not in SYMBOLS or ch == BOUNDARY for ch in word):
+                sys.exit('typogen: %s: %r must be letters, with : only at the ends' % (where, typo))
+            if not correction or word == correction:
+                sys.exit('typogen: %s: %r corrects to itself' % (where, typo))
+            if typo in typos:
+                sys.exit('typogen: %s: %r is listed twice' % (where, typo))
+            typos[typo] = correction
+    if not typos:
+        sys.exit('typogen: no typos in %s' % path)
+    for typo in typos:
+        for other in typos:
+            if other != typo and typo in other:
+                sys.exit('typogen: %r contains %r, which would always fire first' % (other, typo))
+    return typos
+
+
+def real_words(typos, paths):
+    """Typos a word from the lists would trigger, the boundaries as in typo.c."""
+    words = set()
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as f:
+            words.update(w.strip().lower() for w in f if w.strip())
+    found = []
+    for typo in typos:
+        word = typo.strip(BOUNDARY)
+        start, end = typo.startswith(BOUNDARY), typo.endswith(BOUNDARY)
+        for w in words:
+            if (w == word if start and end else w.startswith(word) if start
+                    else w.endswith(word) if end else word in w):
+                found.append((typo, w))
+                break
+    return found
+
+
+def fix(typo, correction):
+    """Backspaces and text that turn the typed keys into the correction."""
+    word = typo.strip(BOUNDARY)
+    common = 0
+    while common < min(len(word), len(correction)) and word[common] == correction[common]:
+        common += 1
+    backspaces = len(word) - common + typo.endswith(BOUNDARY)
+    return backspaces, correction[common:]
+
+
+def build(typos):
+    root = {}
+    for typo, correction in typos.items():
+        node = root
+        for ch in reversed(typo):
+            node = node.setdefault(symbol(ch), {})
+        node[None] = fix(typo, correction)
+    return root
+
+
+def serialise(root):
+    """Root table and trie bytes, plus the worst case reads per key."""
+    data = bytearray()
+
+    def emit(node):
+        """Appends node, returns its worst case reads."""
+        if None in node:
+            backspaces, text = node[None]
+            if backspaces >= MATCH:
+                sys.exit('typogen: a correction needs %d backspaces, at most %d fit' % (backspaces, MATCH - 1))
+            data.append(MATCH | backspaces)
+            data.extend(text.encode('utf-8') + b'\0')
+            return 1
+        children = sorted(node.items())
+        if len(children) == 1:
+            data.append(children[0][0])
+            return 1 + emit(children[0][1])
+        data.append(BRANCH | len(children))
+        table = len(data)
+        data.extend(bytes(3 * len(children)))
+        worst = 1 + len(children)
+        for i, (sym, child) in enumerate(children):
+            data[table + 3 * i] = sym
+            data[table + 3 * i + 1:table + 3 * i + 3] = len(data).to_bytes(2, 'little')
+            worst = max(worst, 1 + (i + 1) + 2 + emit(child))
+        return worst
+
+    table, worst = [NONE] * len(SYMBOLS), 0
+    for sym, child in sorted(root.items()):
+        table[sym - 1] = len(data)
+        worst = max(worst, emit(child))
+    if len(data) >= NONE:
+        sys.exit('typogen: the trie takes %d bytes, at most %d fit' % (len(data), NONE - 1))
+    return table, bytes(data), 2 + worst
+
+
+def write(path, source, table, data, longest):
+    lines = ['#pragma once', '',
+             '// Generated by tools/typogen.py from %s, do not edit.' % source, '',
+             '#define TYPO_MAX_LENGTH %d' % longest, '',
+             '// Node after the last key per symbol, TYPO_NONE if no typo ends with it',
+             'static const uint16_t PROGMEM typo_root[TYPO_SYMBOLS] = {']
+    cells = ['TYPO_NONE' if t == NONE else '%d' % t for t in table]
+    for i in range(0, len(cells), 8):
+        lines.append('    ' + ', '.join(cells[i:i + 8]) + ',')
+    lines += ['};', '', '// clang-format off',
+              'static const uint8_t PROGMEM typo_trie[%d] = {' % len(data)]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines += ['};', '// clang-format on', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source', default=os.path.join(USERSPACE, 'typo', 'typos.txt'))
+    parser.add_argument('--output', default=os.path.join(USERSPACE, 'typo_trie.h'))
+    parser.add_argument('--check', action='store_true', help='validate and print the sizes only')
+    parser.add_argument('--words', action='append', default=[], help='word list no typo may match, repeatable')
+    args = parser.parse_args()
+
+    typos = parse(args.source)
+    found = real_words(typos, args.words)
+    if found:
+        sys.exit('typogen: typos that are (part of) real words: %s' % ', '.join('%s (%s)' % f for f in found))
+    table, data, reads = serialise(build(typos))
+    longest = max(len(typo) for typo in typos)
+    if not args.check:
+        write(args.output, os.path.relpath(args.source, USERSPACE), table, data, longest)
+
+    print('typogen: %d typos, %d bytes of trie + %d of root table, longest typo %d keys, worst case %d flash reads per key' % (
+        len(typos), len(data), 2 * len(table), longest, reads))
+
+
+if __name__ == '__main__':
+    main()
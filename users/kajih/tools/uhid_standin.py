@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Stand-in for the keyboard when developing the raw HID host tools.
+
+Models the firmware side of hid_protocol.c, including the split link to the
+off-hand, so the host tools can be exercised without a board attached:
+
+    uhid_standin.py serve         virtual QMK raw HID device through /dev/uhid
+    uhid_standin.py bench         in-process loopback throughput/latency run
+
+`serve` needs write access to /dev/uhid (usually root). The created hidraw
+node is found by kajih_hid.find_hidraw() like the real keyboard.
+"""
+import argparse
+import os
+import queue
+import statistics
+import struct
+import sys
+import time
+
+import kajih_hid as hid
+
+COLS = 21
+ROWS = 5
+
+# HID_OP_COUNT as HELLO reports it, one past the highest opcode the client knows
+OPCODES = 1 + max(value for name, value in vars(hid).items() if name.startswith('OP_'))
+
+
+class FirmwareModel:
+    """Protocol behaviour of the master half plus the off-hand text buffer."""
+
+    def __init__(self, split_us=0, split_fail_rate=0.0):
+        self.split_us = split_us
+        self.split_fail_rate = split_fail_rate
+        self.split_ok = 0
+        self.split_fail = 0
+        self.split_sent = 0
+        self.text = bytearray(b' ' * (COLS * ROWS))
+        self.cursor = 0
+        self.usage = bytearray(struct.pack('<HH', hid.USAGE_MAGIC, 0)) + bytearray(4 * (hid.USAGE_KEYS + hid.USAGE_LAYERS))
+
+    def _split(self, apply):
+        # One split transaction per forwarded command, like transaction_rpc_send
+        if self.split_us:
+            time.sleep(self.split_us / 1e6)
+        self.split_sent += 1
+        if self.split_fail_rate and (self.split_sent * 2654435761 % 1000) < self.split_fail_rate * 1000:
+            self.split_fail += 1
+            return hid.STATUS_SPLIT_ERROR, b''
+        self.split_ok += 1
+        apply()
+        return hid.STATUS_OK, b''
+
+    def _write(self, data):
+        for ch in data:
+            if self.cursor >= len(self.text):
+                break
+            if ch == ord('\n'):
+                self.cursor += COLS - self.cursor % COLS
+            else:
+                self.text[self.cursor] = ch
+                self.cursor += 1
+
+    def _clear(self):
+        self.text[:] = b' ' * len(self.text)
+        self.cursor = 0
+
+    def _cursor(self, col, row):
+        self.cursor = row * COLS + col
+
+    def handle(self, packet):
+        packet = bytes(packet).ljust(hid.PACKET_SIZE, b'\0')
+        op, seq, args = packet[0], packet[1], packet[2:]
+        if op == hid.OP_HELLO:
+            status, payload = hid.STATUS_OK, bytes([hid.PROTOCOL_VERSION, hid.PACKET_SIZE, COLS, ROWS, OPCODES])
+        elif op == hid.OP_TEXT_WRITE:
+            if args[0] > hid.TEXT_WRITE_MAX:
+                status, payload = hid.STATUS_BAD_ARGS, b''
+            else:
+                status, payload = self._split(lambda: self._write(args[1:1 + args[0]]))
+        elif op == hid.OP_TEXT_CLEAR:
+            status, payload = self._split(self._clear)
+        elif op == hid.OP_CURSOR_SET:
+            if args[0] >= COLS or args[1] >= ROWS:
+                status, payload = hid.STATUS_BAD_ARGS, b''
+            else:
+                status, payload = self._split(lambda: self._cursor(args[0], args[1]))
+        elif op == hid.OP_STATS_GET:
+            status = hid.STATUS_OK
+            payload = struct.pack('<IHHH8HHB', 0, 0, min(self.split_ok, 0xFFFF), min(self.split_fail, 0xFFFF), *([0] * 10))
+            if args[0] & hid.STATS_RESET:
+                self.split_ok = self.split_fail = 0
+        elif op == hid.OP_USAGE_GET:
+            offset = struct.unpack_from('<H', args, 0)[0]
+            if offset > len(self.usage):
+                status, payload = hid.STATUS_BAD_ARGS, b''
+            else:
+                chunk = self.usage[offset:offset + hid.RES_PAYLOAD - 3]
+                status, payload = hid.STATUS_OK, struct.pack('<HB', len(self.usage), len(chunk)) + chunk
+                if args[2] & hid.USAGE_RESET:
+                    self.usage[4:] = bytes(len(self.usage) - 4)
+        elif op == hid.OP_HOLDTAP_GET:
+            # No keys pressed on the stand-in, so no histograms
+            status, payload = hid.STATUS_OK, bytes([0])
+        elif op == hid.OP_MISFIRE_GET:
+            if args[0] >= len(hid.MISFIRE_RULES) or args[1] >= hid.USAGE_KEYS:
+                status, payload = hid.STATUS_BAD_ARGS, b''
+            else:
+                status, payload = hid.STATUS_OK, bytes([len(hid.MISFIRE_RULES), hid.USAGE_KEYS, args[1]])
+        elif op == hid.OP_BATCH_GET:
+            # No keys pressed on the stand-in, so no reports either
+            status, payload = hid.STATUS_OK, struct.pack('<3I', 0, 0, 0)
+        else:
+            status, payload = hid.STATUS_UNKNOWN_OP, b''
+        return (bytes([op, seq, status]) + payload).ljust(hid.PACKET_SIZE, b'\0')
+
+    def screen(self):
+        return [self.text[r * COLS:(r + 1) * COLS].decode('latin-1') for r in range(ROWS)]
+
+
+class LoopbackTransport:
+    """Transport for kajih_hid.Client that answers from a FirmwareModel in-process."""
+
+    def __init__(self, model):
+        self.model = model
+        self.replies = queue.Queue()
+        self.packets = 0
+
+    def send(self, packet):
+        self.packets += 1
+        self.replies.put(self.model.handle(packet))
+
+    def recv(self, timeout):
+        try:
+            return self.replies.get(timeout=timeout)
+        except queue.Empty:
+            return None
+
+    def close(self):
+        pass
+
+
+# linux/uhid.h
+UHID_DESTROY = 1
+UHID_START = 2
+UHID_STOP = 3
+UHID_OPEN = 4
+UHID_CLOSE = 5
+UHID_OUTPUT = 6
+UHID_CREATE2 = 11
+UHID_INPUT2 = 12
+UHID_EVENT_SIZE = 4380
+UHID_DATA_MAX = 4096
+BUS_USB = 0x03
+
+RAW_HID_DESCRIPTOR = bytes([
+    0x06, 0x60, 0xFF,  # Usage Page (0xFF60)
+    0x09, 0x61,        # Usage (0x61)
+    0xA1, 0x01,        # Collection (Application)
+    0x09, 0x62,        #   Usage (0x62)
+    0x15, 0x00,        #   Logical Minimum (0)
+    0x26, 0xFF, 0x00,  #   Logical Maximum (255)
+    0x95, 0x20,        #   Report Count (32)
+    0x75, 0x08,        #   Report Size (8)
+    0x81, 0x02,        #   Input (Data, Variable, Absolute)
+    0x09, 0x63,        #   Usage (0x63)
+    0x15, 0x00,        #   Logical Minimum (0)
+    0x26, 0xFF, 0x00,  #   Logical Maximum (255)
+    0x95, 0x20,        #   Report Count (32)
+    0x75, 0x08,        #   Report Size (8)
+    0x91, 0x02,        #   Output (Data, Variable, Absolute)
+    0xC0,              # End Collection
+])
+
+
+def uhid_create(fd, name, vendor=0x8D1D, product=0x9D9D):
+    event = struct.pack('<I128s64s64sHHIIII', UHID_CREATE2, name.encode(), b'', b'', len(RAW_HID_DESCRIPTOR), BUS_USB, vendor, product, 0, 0)
+    os.write(fd, (event + RAW_HID_DESCRIPTOR).ljust(UHID_EVENT_SIZE, b'\0'))
+
+
+def uhid_input(fd, data):
+    event = struct.pack('<IH', UHID_INPUT2, len(data)) + data
+    os.write(fd, event.ljust(UHID_EVENT_SIZE, b'\0'))
+
+
+def serve(args):
+    model = FirmwareModel(args.split_us, args.split_fail_rate)
+    fd = os.open('/dev/uhid', os.O_RDWR)
+    uhid_create(fd, 'kajih raw HID stand-in')
+    print('created virtual raw HID device, Ctrl-C to stop', file=sys.stderr)
+    last = None
+    try:
+        while True:
+            event = os.read(fd, UHID_EVENT_SIZE)
+            etype, = struct.unpack_from('<I', event, 0)
+            if etype != UHID_OUTPUT:
+                continue
+            data = event[4:4 + UHID_DATA_MAX]
+            size, = struct.unpack_from('<H', event, 4 + UHID_DATA_MAX)
+            packet = data[:size]
+            # hidraw writes carry the report number in front
+            if size == hid.PACKET_SIZE + 1:
+                packet = packet[1:]
+            uhid_input(fd, model.handle(packet))
+            screen = model.screen()
+            if args.show and screen != last:
+                print('\n'.join('|%s|' % row for row in screen) + '\n', file=sys.stderr)
+                last = screen
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.write(fd, struct.pack('<I', UHID_DESTROY).ljust(UHID_EVENT_SIZE, b'\0'))
+        os.close(fd)
+
+
+def bench(args):
+    model = FirmwareModel(args.split_us, args.split_fail_rate)
+    client = hid.Client(LoopbackTransport(model))
+    client.hello()
+
+    latencies = []
+    text = 'x' * hid.TEXT_WRITE_MAX
+    start = time.perf_counter()
+    for i in range(args.count):
+        t = time.perf_counter()
+        try:
+            client.text_write(text) if i % 2 else client.cursor_set(0, i % ROWS)
+        except hid.ProtocolError:
+            pass
+        latencies.append((time.perf_counter() - t) * 1e6)
+    elapsed = time.perf_counter() - start
+
+    latencies.sort()
+    print('requests       %d' % args.count)
+    print('throughput     %.0f req/s, %.1f kB/s text' % (args.count / elapsed, args.count / 2 * len(text) / elapsed / 1000))
+    print('latency p50    %.0f us' % statistics.median(latencies))
+    print('latency p99    %.0f us' % latencies[int(len(latencies) * 0.99) - 1])
+    print('split ok/fail  %d/%d' % (model.split_ok, model.split_fail))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--split-us', type=int, default=1000, help='simulated split transaction time per forwarded command')
+    parser.add_argument('--split-fail-rate', type=float, default=0.0, help='fraction of split transactions that fail')
+    sub = parser.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('serve')
+    p.add_argument('--show', action='store_true', help='print the off-hand screen when it changes')
+    p = sub.add_parser('bench')
+    p.add_argument('--count', type=int, default=2000)
+    args = parser.parse_args()
+    serve(args) if args.command == 'serve' else bench(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Read the per key and per layer press counters from the keyboard.
+
+Counts are shown in the Kyria LAYOUT() shape, optionally as a share of all
+presses, followed by the per layer totals and, when the firmware is built with
+REPORT_BATCH_ENABLE, the keyboard reports sent per keystroke. --json writes the raw numbers for
+further processing (layout tools, spreadsheets).
+
+    usage_report.py                 autodetect the keyboard
+    usage_report.py --percent       per key share instead of counts
+    usage_report.py --json FILE     also save the counters as JSON
+    usage_report.py --reset         clear the counters after reading
+"""
+import argparse
+import json
+import sys
+
+import kajih_hid as hid
+
+# LAYOUT() rows as (left indices, right indices), see users/kajih/geometry.h
+ROWS = [
+    (range(0, 6), range(6, 12)),
+    (range(12, 18), range(18, 24)),
+    (range(24, 32), range(32, 40)),
+    (range(40, 45), range(45, 50)),
+]
+CELL = 6
+
+
+def render(keys, percent):
+    total = sum(keys) or 1
+
+    def cell(i):
+        return ('%5.1f' % (100.0 * keys[i] / total) if percent else '%5d' % keys[i]).rjust(CELL)
+
+    lines = []
+    half = 8 * CELL
+    for left, right in ROWS:
+        l = ''.join(cell(i) for i in left)
+        r = ''.join(cell(i) for i in right)
+        # Outer columns line up, the thumb row is centred under the inner keys
+        if len(left) < 8:
+            l = l.rjust(half) if len(left) == 5 else l.ljust(half)
+            r = r.ljust(half) if len(right) == 5 else r.rjust(half)
+        lines.append(l + '   ' + r)
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--device', help='hidraw node, autodetected by default')
+    parser.add_argument('--percent', action='store_true', help='show each key as a share of all presses')
+    parser.add_argument('--json', metavar='FILE', help='write the counters to FILE as JSON')
+    parser.add_argument('--reset', action='store_true', help='clear the counters after reading')
+    parser.add_argument('--loopback', action='store_true', help='talk to the in-process stand-in instead of a keyboard')
+    args = parser.parse_args()
+
+    if args.loopback:
+        import uhid_standin
+        client = hid.Client(uhid_standin.LoopbackTransport(uhid_standin.FirmwareModel()))
+    else:
+        client = hid.open_client(args.device)
+
+    client.hello()
+    usage = client.usage(args.reset)
+    try:
+        batch = client.batch(args.reset)
+    except hid.ProtocolError:
+        batch = None
+
+    print(render(usage.keys, args.percent))
+    print()
+    print('presses %d, saved %d times' % (sum(usage.keys), usage.flushes))
+    for layer, count in enumerate(usage.layers):
+        if count:
+            print('layer %2d  %8d' % (layer, count))
+    if batch is not None:
+        print('reports %d of %d submitted, %.3f per keystroke' % (
+            batch.sent, batch.submitted, batch.sent / (batch.presses or 1)))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'flushes': usage.flushes, 'keys': usage.keys, 'layers': usage.layers,
+                       'batch': batch._asdict() if batch else None}, f, indent=1)
+            f.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
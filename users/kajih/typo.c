@@ -0,0 +1,169 @@
+#include "typo.h"
+#include "kajih.h"
+
+#include <string.h>
+
+#include "typo_trie.h"
+
+// Newest symbol last, starts at a word boundary
+static uint8_t buffer[TYPO_MAX_LENGTH] = {TYPO_BOUNDARY};
+static uint8_t length                 = 1;
+
+static void typo_push(uint8_t symbol) {
+    if (length == TYPO_MAX_LENGTH) {
+        memmove(buffer, buffer + 1, --length);
+    }
+    buffer[length++] = symbol;
+}
+
+// Not a trie symbol: the key did something other than type, forget the word
+#define TYPO_RESET 0xFF
+
+// Symbol typed by a basic keycode, 0 for keys that leave the buffer alone
+static uint8_t typo_symbol(uint16_t keycode) {
+    switch (keycode) {
+        case KC_A ... KC_Z:
+            return TYPO_A + keycode - KC_A;
+        case KC_LBRC:
+            return TYPO_ARNG;
+        case KC_QUOT:
+            return TYPO_ADIA;
+        case KC_SCLN:
+            return TYPO_ODIA;
+        case KC_NUHS:
+            return TYPO_QUOT;
+        case KC_1 ... KC_ENTER:
+        case KC_TAB ... KC_EQUAL:
+        case KC_RIGHT_BRACKET ... KC_BACKSLASH:
+        case KC_GRAVE ... KC_SLASH:
+        case KC_NONUS_BACKSLASH:
+            // Typed a character, Backspace takes it away like a letter
+            return TYPO_BOUNDARY;
+        case QK_MODS ... QK_MODS_MAX:
+            // Shifted letters stay letters, AltGr and the rest are symbols
+            if ((QK_MODS_GET_MODS(keycode) & 0x0F) == MOD_LSFT) {
+                return typo_symbol(QK_MODS_GET_BASIC_KEYCODE(keycode));
+            }
+            switch (typo_symbol(QK_MODS_GET_BASIC_KEYCODE(keycode))) {
+                case 0:
+                case TYPO_RESET:
+                    return TYPO_RESET;
+                default:
+                    return TYPO_BOUNDARY;
+            }
+        case KC_LCTL ... KC_RGUI:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+#ifdef ONE_SHOT_ENABLE
+        case ONE_SHOT_MOD ... ONE_SHOT_LAYER_MAX:
+#endif
+            return 0;
+        default:
+            // Tap dances, layer switches, arrows and the rest, which QMK's
+            // autocorrect does not count as typing either
+            return TYPO_RESET;
+    }
+}
+
+// Trie node after the newest symbol that is a match, or TYPO_NONE
+static uint16_t typo_find(void) {
+    uint8_t  pos   = length - 1;
+    uint16_t state = pgm_read_word(&typo_root[buffer[pos] - 1]);
+    while (state != TYPO_NONE) {
+        uint8_t code = pgm_read_byte(&typo_trie[state]);
+        if (code & TYPO_MATCH) {
+            return state;
+        }
+        if (!pos) {
+            break;
+        }
+        uint8_t symbol = buffer[--pos];
+        if (!(code & TYPO_BRANCH)) {
+            state = code == symbol ? state + 1 : TYPO_NONE;
+            continue;
+        }
+
+        // Children are sorted, stop at the first one not below the symbol
+        uint16_t child = state + 1;
+        state          = TYPO_NONE;
+        for (uint8_t n = code & ~TYPO_BRANCH; n; n--, child += 3) {
+            uint8_t next = pgm_read_byte(&typo_trie[child]);
+            if (next >= symbol) {
+                if (next == symbol) {
+                    state = pgm_read_word(&typo_trie[child + 1]);
+                }
+                break;
+            }
+        }
+    }
+    return TYPO_NONE;
+}
+
+static void typo_fix(uint16_t state, uint16_t keycode) {
+    uint8_t backspaces = pgm_read_byte(&typo_trie[state]) & ~TYPO_MATCH;
+
+    // The key that completed the typo is still down, let go of it first so a
+    // correction typing the same key is seen
+    unregister_code16(keycode);
+    for (uint8_t i = 0; i < backspaces; i++) {
+        tap_code(KC_BSPC);
+    }
+#ifdef SEND_SE_ENABLE
+    send_se_P((const char *)&typo_trie[state + 1]);
+#else
+    send_string_P((const char *)&typo_trie[state + 1]);
+#endif
+
+    // A typo ending at a word boundary counted that key in its backspaces
+    if (buffer[length - 1] == TYPO_BOUNDARY) {
+        tap_code16(keycode);
+        buffer[0] = TYPO_BOUNDARY;
+        length    = 1;
+    } else {
+        length = 0;
+    }
+}
+
+void typo_post_process(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return;
+    }
+    if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+        if (!record->tap.count) {
+            return;
+        }
+        keycode = IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    }
+
+    uint8_t mods = get_mods() | get_oneshot_mods();
+    if (mods & (MOD_MASK_CTRL | MOD_MASK_ALT | MOD_MASK_GUI)) {
+        length = 0;
+        return;
+    }
+    if (keycode == KC_BSPC) {
+        if (length) {
+            length--;
+        }
+        return;
+    }
+
+    uint8_t symbol = typo_symbol(keycode);
+    if (!symbol) {
+        return;
+    }
+    if (symbol == TYPO_RESET) {
+        length = 0;
+        return;
+    }
+    typo_push(symbol);
+
+    uint16_t state = typo_find();
+    if (state != TYPO_NONE) {
+        typo_fix(state, keycode);
+    } else if (symbol == TYPO_BOUNDARY) {
+        buffer[0] = TYPO_BOUNDARY;
+        length    = 1;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+
+// Typo correction from a suffix trie compiled by tools/typogen.py out of
+// typo/typos.txt (see typo_trie.h). The last TYPO_MAX_LENGTH keys are kept as
+// symbols and every key press walks the trie from the newest one back, which
+// reads at most the flash bytes typogen.py reports as the worst case. A match
+// taps Backspace and types the rest of the correction, with send_se() when
+// SEND_SE_ENABLE is on.
+//
+// Letters, å ä ö (on a Swedish host) and ' are kept, Backspace forgets the
+// last one and other keys typing a character (space, digits, punctuation,
+// their shifted and AltGr forms) are word boundaries. Any other key (arrows,
+// tap dances, layer switches) clears the buffer without correcting, like QMK's
+// autocorrect. Ctrl, Alt and GUI clear it too, so shortcuts never correct.
+
+// Trie symbols, must match SYMBOLS in tools/typogen.py
+#define TYPO_BOUNDARY 1
+#define TYPO_A 2 // a .. z are 2 .. 27
+#define TYPO_ARNG 28
+#define TYPO_ADIA 29
+#define TYPO_ODIA 30
+#define TYPO_QUOT 31
+#define TYPO_SYMBOLS 31
+
+#define TYPO_BRANCH 0x40
+#define TYPO_MATCH 0x80
+#define TYPO_NONE 0xFFFF
+
+void typo_post_process(uint16_t keycode, keyrecord_t *record);
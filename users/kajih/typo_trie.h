@@ -0,0 +1,95 @@
+#pragma once
+
+// Generated by tools/typogen.py from typo/typos.txt, do not edit.
+
+#define TYPO_MAX_LENGTH 12
+
+// Node after the last key per symbol, TYPO_NONE if no typo ends with it
+static const uint16_t PROGMEM typo_root[TYPO_SYMBOLS] = {
+    0, 201, TYPO_NONE, TYPO_NONE, 268, 340, TYPO_NONE, 569,
+    607, 617, TYPO_NONE, 625, 647, TYPO_NONE, 692, 806,
+    TYPO_NONE, TYPO_NONE, 848, 969, 993, 1188, TYPO_NONE, 1196,
+    TYPO_NONE, TYPO_NONE, TYPO_NONE, 1205, TYPO_NONE, TYPO_NONE, TYPO_NONE,
+};
+
+// clang-format off
+static const uint8_t PROGMEM typo_trie[1232] = {
+    0x4A, 0x02, 0x1F, 0x00, 0x05, 0x26, 0x00, 0x06, 0x2E, 0x00, 0x08, 0x37, 0x00, 0x09, 0x3F, 0x00,
+    0x0D, 0x46, 0x00, 0x0E, 0x4D, 0x00, 0x0F, 0x54, 0x00, 0x13, 0x6D, 0x00, 0x15, 0x84, 0x00, 0x08,
+    0x0B, 0x01, 0x83, 0x61, 0x67, 0x00, 0x02, 0x0F, 0x01, 0x84, 0x61, 0x6E, 0x64, 0x00, 0x17, 0x0A,
+    0x01, 0x84, 0x49, 0x27, 0x76, 0x65, 0x00, 0x0B, 0x02, 0x01, 0x84, 0x6A, 0x61, 0x67, 0x00, 0x06,
+    0x15, 0x01, 0x83, 0x68, 0x65, 0x00, 0x0D, 0x0A, 0x15, 0x0F, 0x16, 0x82, 0x00, 0x0A, 0x01, 0x83,
+    0x49, 0x27, 0x6D, 0x00, 0x42, 0x02, 0x5B, 0x00, 0x05, 0x67, 0x00, 0x0E, 0x0E, 0x02, 0x14, 0x0D,
+    0x0D, 0x0A, 0x15, 0x01, 0x81, 0x73, 0x00, 0x02, 0x01, 0x83, 0x6E, 0x64, 0x00, 0x42, 0x07, 0x74,
+    0x00, 0x1D, 0x7D, 0x00, 0x13, 0x02, 0x17, 0x01, 0x82, 0xC3, 0xB6, 0x72, 0x00, 0x17, 0x1A, 0x15,
+    0x01, 0x81, 0x72, 0x00, 0x43, 0x09, 0x8E, 0x00, 0x0F, 0x96, 0x00, 0x10, 0xC0, 0x00, 0x02, 0x15,
+    0x01, 0x84, 0x68, 0x61, 0x74, 0x00, 0x43, 0x05, 0xA0, 0x00, 0x10, 0xA7, 0x00, 0x14, 0xAD, 0x00,
+    0x0A, 0x05, 0x01, 0x82, 0x27, 0x74, 0x00, 0x05, 0x01, 0x82, 0x27, 0x74, 0x00, 0x42, 0x06, 0xB4,
+    0x00, 0x0A, 0xBB, 0x00, 0x10, 0x05, 0x01, 0x82, 0x27, 0x74, 0x00, 0x01, 0x82, 0x27, 0x74, 0x00,
+    0x0D, 0x02, 0x01, 0x84, 0x20, 0x6C, 0x6F, 0x74, 0x00, 0x43, 0x08, 0xD3, 0x00, 0x0F, 0xF5, 0x00,
+    0x13, 0x00, 0x01, 0x05, 0x42, 0x06, 0xDB, 0x00, 0x0F, 0xE2, 0x00, 0x13, 0x07, 0x01, 0x82, 0x61,
+    0x67, 0x00, 0x42, 0x1C, 0xE9, 0x00, 0x1E, 0xEF, 0x00, 0x0E, 0x01, 0x82, 0x61, 0x67, 0x00, 0x14,
+    0x01, 0x82, 0x61, 0x67, 0x00, 0x05, 0x1D, 0x17, 0x0F, 0x02, 0x01, 0x83, 0x6E, 0x64, 0x61, 0x00,
+    0x08, 0x06, 0x0F, 0x16, 0x07, 0x01, 0x84, 0x67, 0x65, 0x72, 0x61, 0x00, 0x44, 0x02, 0x19, 0x01,
+    0x06, 0x23, 0x01, 0x0F, 0x3F, 0x01, 0x13, 0x4A, 0x01, 0x0F, 0x1D, 0x17, 0x0F, 0x02, 0x01, 0x82,
+    0x64, 0x61, 0x00, 0x42, 0x08, 0x2A, 0x01, 0x13, 0x36, 0x01, 0x0F, 0x0A, 0x14, 0x0F, 0x16, 0x01,
+    0x84, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x16, 0x04, 0x04, 0x10, 0x82, 0x72, 0x65, 0x64, 0x00, 0x0A,
+    0x06, 0x13, 0x07, 0x01, 0x84, 0x69, 0x65, 0x6E, 0x64, 0x00, 0x06, 0x0A, 0x18, 0x01, 0x84, 0x65,
+    0x69, 0x72, 0x64, 0x00, 0x4A, 0x02, 0x73, 0x01, 0x04, 0x7B, 0x01, 0x05, 0x89, 0x01, 0x0C, 0x98,
+    0x01, 0x0F, 0xA3, 0x01, 0x13, 0xAF, 0x01, 0x14, 0xB7, 0x01, 0x15, 0xC3, 0x01, 0x16, 0x02, 0x02,
+    0x17, 0x0D, 0x02, 0x0C, 0x0E, 0x01, 0x83, 0x61, 0x6B, 0x65, 0x00, 0x0F, 0x02, 0x13, 0x16, 0x04,
+    0x04, 0x10, 0x84, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x00, 0x02, 0x0F, 0x0D, 0x06, 0x05, 0x05, 0x06,
+    0x0E, 0x01, 0x84, 0x61, 0x6E, 0x64, 0x65, 0x00, 0x0F, 0x14, 0x02, 0x0C, 0x01, 0x84, 0x6E, 0x73,
+    0x6B, 0x65, 0x00, 0x08, 0x0A, 0x0D, 0x0C, 0x13, 0x06, 0x17, 0x01, 0x82, 0x65, 0x6E, 0x00, 0x15,
+    0x07, 0x06, 0x01, 0x82, 0x65, 0x72, 0x00, 0x02, 0x16, 0x04, 0x06, 0x03, 0x01, 0x84, 0x61, 0x75,
+    0x73, 0x65, 0x00, 0x45, 0x02, 0xD3, 0x01, 0x05, 0xDE, 0x01, 0x09, 0xE8, 0x01, 0x0C, 0xEE, 0x01,
+    0x0D, 0xF6, 0x01, 0x11, 0x05, 0x16, 0x01, 0x85, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x02, 0x11,
+    0x16, 0x01, 0x84, 0x64, 0x61, 0x74, 0x65, 0x00, 0x01, 0x83, 0x74, 0x68, 0x65, 0x00, 0x04, 0x1A,
+    0x0E, 0x01, 0x82, 0x65, 0x74, 0x00, 0x02, 0x11, 0x0E, 0x06, 0x15, 0x01, 0x84, 0x6C, 0x61, 0x74,
+    0x65, 0x00, 0x14, 0x02, 0x04, 0x06, 0x03, 0x01, 0x83, 0x75, 0x73, 0x65, 0x00, 0x42, 0x06, 0x14,
+    0x02, 0x0A, 0x1F, 0x02, 0x0A, 0x04, 0x06, 0x13, 0x01, 0x84, 0x65, 0x69, 0x76, 0x65, 0x00, 0x06,
+    0x42, 0x09, 0x27, 0x02, 0x0D, 0x30, 0x02, 0x04, 0x02, 0x01, 0x84, 0x69, 0x65, 0x76, 0x65, 0x00,
+    0x06, 0x03, 0x01, 0x84, 0x69, 0x65, 0x76, 0x65, 0x00, 0x43, 0x02, 0x43, 0x02, 0x0A, 0x4B, 0x02,
+    0x0F, 0x54, 0x02, 0x1C, 0x13, 0x07, 0x01, 0x82, 0x67, 0x61, 0x00, 0x0F, 0x09, 0x15, 0x01, 0x83,
+    0x69, 0x6E, 0x67, 0x00, 0x13, 0x0A, 0x15, 0x14, 0x01, 0x84, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x15,
+    0x08, 0x0A, 0x06, 0x09, 0x01, 0x82, 0x68, 0x74, 0x00, 0x14, 0x09, 0x15, 0x01, 0x82, 0x69, 0x73,
+    0x00, 0x06, 0x42, 0x0A, 0x79, 0x02, 0x14, 0x7F, 0x02, 0x0D, 0x01, 0x82, 0x6B, 0x65, 0x00, 0x0F,
+    0x02, 0x0C, 0x01, 0x82, 0x6B, 0x65, 0x00, 0x42, 0x02, 0x8E, 0x02, 0x05, 0x98, 0x02, 0x15, 0x0A,
+    0x0F, 0x0A, 0x01, 0x82, 0x69, 0x61, 0x6C, 0x00, 0x16, 0x10, 0x43, 0x04, 0xA4, 0x02, 0x09, 0xA9,
+    0x02, 0x18, 0xAF, 0x02, 0x01, 0x82, 0x6C, 0x64, 0x00, 0x14, 0x01, 0x82, 0x6C, 0x64, 0x00, 0x01,
+    0x82, 0x6C, 0x64, 0x00, 0x44, 0x06, 0xC1, 0x02, 0x10, 0xE6, 0x02, 0x15, 0x14, 0x03, 0x16, 0x1C,
+    0x03, 0x08, 0x42, 0x0A, 0xC9, 0x02, 0x0D, 0xD8, 0x02, 0x15, 0x0D, 0x0F, 0x06, 0x08, 0x06, 0x01,
+    0x86, 0x74, 0x6C, 0x69, 0x67, 0x65, 0x6E, 0x00, 0x0A, 0x15, 0x0F, 0x06, 0x08, 0x06, 0x01, 0x85,
+    0x6C, 0x69, 0x67, 0x65, 0x6E, 0x00, 0x43, 0x0A, 0xF0, 0x02, 0x15, 0xFE, 0x02, 0x1C, 0x0A, 0x03,
+    0x15, 0x0F, 0x04, 0x16, 0x07, 0x01, 0x86, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x0A, 0x04,
+    0x0F, 0x16, 0x07, 0x01, 0x84, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x08, 0x0F, 0x01, 0x84, 0xC3, 0xA5,
+    0x67, 0x6F, 0x6E, 0x00, 0x0A, 0x13, 0x11, 0x01, 0x82, 0x6E, 0x74, 0x00, 0x13, 0x15, 0x06, 0x13,
+    0x01, 0x83, 0x75, 0x72, 0x6E, 0x00, 0x44, 0x0D, 0x33, 0x03, 0x0F, 0x3B, 0x03, 0x16, 0x43, 0x03,
+    0x18, 0x49, 0x03, 0x14, 0x02, 0x01, 0x83, 0x6C, 0x73, 0x6F, 0x00, 0x08, 0x1C, 0x0F, 0x01, 0x82,
+    0x6F, 0x6E, 0x00, 0x1A, 0x01, 0x82, 0x6F, 0x75, 0x00, 0x0F, 0x0C, 0x01, 0x82, 0x6F, 0x77, 0x00,
+    0x45, 0x02, 0x60, 0x03, 0x06, 0x7E, 0x03, 0x15, 0xA9, 0x03, 0x17, 0xB2, 0x03, 0x1E, 0xBD, 0x03,
+    0x42, 0x06, 0x67, 0x03, 0x0F, 0x70, 0x03, 0x08, 0x0F, 0x16, 0x07, 0x01, 0x82, 0x72, 0x61, 0x00,
+    0x08, 0x0A, 0x0F, 0x14, 0x0D, 0x1D, 0x09, 0x01, 0x84, 0x6E, 0x67, 0x61, 0x72, 0x00, 0x43, 0x0A,
+    0x88, 0x03, 0x15, 0x90, 0x03, 0x17, 0x9C, 0x03, 0x09, 0x15, 0x01, 0x83, 0x65, 0x69, 0x72, 0x00,
+    0x0E, 0x02, 0x13, 0x02, 0x11, 0x01, 0x83, 0x65, 0x74, 0x65, 0x72, 0x00, 0x1E, 0x09, 0x03, 0x01,
+    0x85, 0x65, 0x68, 0xC3, 0xB6, 0x76, 0x65, 0x72, 0x00, 0x06, 0x07, 0x06, 0x01, 0x83, 0x74, 0x65,
+    0x72, 0x00, 0x06, 0x1E, 0x09, 0x06, 0x03, 0x01, 0x83, 0x76, 0x65, 0x72, 0x00, 0x13, 0x07, 0x02,
+    0x17, 0x01, 0x84, 0x72, 0x66, 0xC3, 0xB6, 0x72, 0x00, 0x42, 0x09, 0xD0, 0x03, 0x1C, 0xD8, 0x03,
+    0x0A, 0x15, 0x01, 0x83, 0x68, 0x69, 0x73, 0x00, 0x0C, 0x04, 0x10, 0x01, 0x82, 0x73, 0xC3, 0xA5,
+    0x00, 0x47, 0x02, 0xF7, 0x03, 0x08, 0x37, 0x04, 0x09, 0x43, 0x04, 0x0C, 0x6C, 0x04, 0x0F, 0x76,
+    0x04, 0x13, 0x84, 0x04, 0x16, 0x8D, 0x04, 0x44, 0x05, 0x04, 0x04, 0x0F, 0x11, 0x04, 0x13, 0x25,
+    0x04, 0x15, 0x2F, 0x04, 0x10, 0x0E, 0x10, 0x04, 0x04, 0x02, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74,
+    0x00, 0x42, 0x0A, 0x18, 0x04, 0x18, 0x1F, 0x04, 0x07, 0x06, 0x05, 0x82, 0x69, 0x74, 0x00, 0x01,
+    0x83, 0x61, 0x6E, 0x74, 0x00, 0x06, 0x11, 0x06, 0x14, 0x84, 0x61, 0x72, 0x61, 0x74, 0x00, 0x09,
+    0x01, 0x84, 0x74, 0x68, 0x61, 0x74, 0x00, 0x0D, 0x0A, 0x0B, 0x1E, 0x0E, 0x01, 0x84, 0x6C, 0x69,
+    0x67, 0x74, 0x00, 0x44, 0x02, 0x50, 0x04, 0x05, 0x57, 0x04, 0x08, 0x5E, 0x04, 0x0A, 0x66, 0x04,
+    0x18, 0x01, 0x83, 0x68, 0x61, 0x74, 0x00, 0x0A, 0x18, 0x01, 0x82, 0x74, 0x68, 0x00, 0x0F, 0x06,
+    0x0D, 0x01, 0x82, 0x74, 0x68, 0x00, 0x18, 0x01, 0x82, 0x74, 0x68, 0x00, 0x06, 0x04, 0x1A, 0x0E,
+    0x01, 0x83, 0x6B, 0x65, 0x74, 0x00, 0x06, 0x0E, 0x06, 0x16, 0x08, 0x13, 0x02, 0x01, 0x85, 0x6D,
+    0x65, 0x6E, 0x74, 0x00, 0x14, 0x1E, 0x07, 0x01, 0x83, 0x72, 0x73, 0x74, 0x00, 0x42, 0x04, 0x94,
+    0x04, 0x14, 0x9D, 0x04, 0x13, 0x15, 0x14, 0x01, 0x83, 0x75, 0x63, 0x74, 0x00, 0x0B, 0x01, 0x83,
+    0x75, 0x73, 0x74, 0x00, 0x13, 0x10, 0x1A, 0x01, 0x82, 0x75, 0x72, 0x00, 0x0F, 0x10, 0x0C, 0x01,
+    0x83, 0x6E, 0x6F, 0x77, 0x00, 0x42, 0x0C, 0xBC, 0x04, 0x14, 0xC6, 0x04, 0x14, 0x04, 0x10, 0x01,
+    0x83, 0x6B, 0x73, 0xC3, 0xA5, 0x00, 0x09, 0x04, 0x10, 0x01, 0x83, 0x6B, 0x73, 0xC3, 0xA5, 0x00,
+};
+// clang-format on
@@ -0,0 +1,89 @@
+#include "usage.h"
+#ifdef CHORD_ENABLE
+#    include "chord.h"
+#endif
+
+#include <string.h>
+
+_Static_assert(sizeof(usage_t) <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE too small for usage_t");
+
+usage_t usage;
+
+// Dirty spans, in counter indices, so a flush only rewrites what changed
+static uint8_t  keys_lo = UINT8_MAX, keys_hi;
+static uint8_t  layers_lo = UINT8_MAX, layers_hi;
+static uint32_t last_flush;
+
+static inline void mark(uint8_t *lo, uint8_t *hi, uint8_t index) {
+    if (index < *lo) {
+        *lo = index;
+    }
+    if (index + 1 > *hi) {
+        *hi = index + 1;
+    }
+}
+
+void usage_init(void) {
+    eeconfig_read_user_datablock(&usage, 0, sizeof(usage));
+    if (usage.magic != USAGE_MAGIC) {
+        memset(&usage, 0, sizeof(usage));
+        usage.magic = USAGE_MAGIC;
+        eeconfig_update_user_datablock(&usage, 0, sizeof(usage));
+    }
+    last_flush = timer_read32();
+}
+
+void usage_record(keyrecord_t *record) {
+    if (!record->event.pressed || !IS_KEYEVENT(record->event)) {
+        return;
+    }
+#ifdef CHORD_ENABLE
+    // Held back presses come through a second time when replayed
+    if (chord_replaying()) {
+        return;
+    }
+#endif
+    uint8_t index = geo_index(GEO_POS(record->event.key.row, record->event.key.col));
+    if (index != GEO_NONE && usage.keys[index] < UINT32_MAX) {
+        usage.keys[index]++;
+        mark(&keys_lo, &keys_hi, index);
+    }
+    uint8_t layer = get_highest_layer(layer_state | default_layer_state);
+    if (layer < USAGE_LAYERS && usage.layers[layer] < UINT32_MAX) {
+        usage.layers[layer]++;
+        mark(&layers_lo, &layers_hi, layer);
+    }
+}
+
+static void flush_span(const uint32_t *counters, uint8_t *lo, uint8_t *hi) {
+    if (*lo < *hi) {
+        uint32_t offset = (const uint8_t *)&counters[*lo] - (const uint8_t *)&usage;
+        eeconfig_update_user_datablock(&counters[*lo], offset, (*hi - *lo) * sizeof(uint32_t));
+    }
+    *lo = UINT8_MAX;
+    *hi = 0;
+}
+
+void usage_task(void) {
+    if (keys_lo >= keys_hi && layers_lo >= layers_hi) {
+        return;
+    }
+    // Writes stall the scan on flash backed EEPROM, so wait for a pause in typing
+    if (timer_elapsed32(last_flush) < USAGE_FLUSH_INTERVAL || last_input_activity_elapsed() < USAGE_FLUSH_IDLE) {
+        return;
+    }
+    usage.flushes++;
+    eeconfig_update_user_datablock(&usage.flushes, offsetof(usage_t, flushes), sizeof(usage.flushes));
+    flush_span(usage.keys, &keys_lo, &keys_hi);
+    flush_span(usage.layers, &layers_lo, &layers_hi);
+    last_flush = timer_read32();
+}
+
+void usage_reset(void) {
+    memset(usage.keys, 0, sizeof(usage.keys));
+    memset(usage.layers, 0, sizeof(usage.layers));
+    keys_lo   = 0;
+    keys_hi   = GEO_KEYS;
+    layers_lo = 0;
+    layers_hi = USAGE_LAYERS;
+}
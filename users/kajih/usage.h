@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "quantum.h"
+#include "geometry.h"
+
+// Press counters per key (LAYOUT index) and per layer, kept in RAM and
+// written back to the EEPROM user datablock in batches.
+
+#define USAGE_MAGIC 0x5542 // "UB", bump when usage_t changes shape
+#ifndef USAGE_LAYERS
+#    define USAGE_LAYERS 16
+#endif
+// Minimum time between two writes, and how long the keyboard must be idle first
+#ifndef USAGE_FLUSH_INTERVAL
+#    define USAGE_FLUSH_INTERVAL 900000
+#endif
+#ifndef USAGE_FLUSH_IDLE
+#    define USAGE_FLUSH_IDLE 5000
+#endif
+
+// Stored as is, this is also the HID dump format (little endian, no padding)
+typedef struct {
+    uint16_t magic;
+    uint16_t flushes;
+    uint32_t keys[GEO_KEYS];
+    uint32_t layers[USAGE_LAYERS];
+} usage_t;
+
+_Static_assert(sizeof(usage_t) == 4 + 4 * (GEO_KEYS + USAGE_LAYERS), "usage_t must not be padded");
+
+extern usage_t usage;
+
+void usage_init(void);
+void usage_record(keyrecord_t *record);
+void usage_task(void);
+void usage_reset(void);